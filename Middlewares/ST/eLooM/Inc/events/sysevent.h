@@ -30,6 +30,12 @@ extern "C" {
 #include "services/systypes.h"
 
 
+/**
+ * Value of SysEvent::nAttachment for an event without attachment.
+ */
+#define SYS_EVT_ATTACHMENT_NONE       0U
+
+
 /**
  * Specifies the structure of a system event that is possible to send to the Init task.
  */
@@ -48,10 +54,26 @@ typedef union _SysEvent {
 		 */
 		uint32_t nParam: 5;
 
+		/**
+		 * Used by the framework. It is set when the event has been posted with SysPostPowerModeEventReplace().
+		 */
+		uint32_t nReplace: 1;
+
+		/**
+		 * Specifies the attachment of the event: ::SYS_EVT_ATTACHMENT_NONE, or the index plus one of a block
+		 * of the system event pool. Use SysEvtAttach() and SysEvtGetAttachment() to operate it (see syseventpool.h).
+		 */
+		uint32_t nAttachment: 5;
+
+		/**
+		 * Used by the framework. It is the sequence number of the event in its lane, set by SysPostEvent().
+		 */
+		uint32_t nSeq: 16;
+
 		/**
 		 * reserved. It must be zero.
 		 */
-		uint32_t reserved: 23;
+		uint32_t reserved: 1;
 
 		/**
 		 * Specifies the type of the system event. For an error event it must be set to 1.
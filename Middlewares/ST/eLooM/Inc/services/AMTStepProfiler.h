@@ -0,0 +1,265 @@
+/**
+ ******************************************************************************
+ * @file    AMTStepProfiler.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Profiler of the step execution of the managed tasks.
+ *
+ * The task control loops (AMTRun(), AMTExRun(), APMTRun()) measure the duration of each step
+ * with the DWT cycle counter, and the profiler keeps, for each power mode of a task:
+ * - the statistics (count, min / max / mean) of the step duration.
+ * - an histogram of the step duration used to compute the percentiles (see AMTSPGetPercentile()).
+ * - the number of steps longer than the budget declared by the application.
+ *
+ * Only the tasks with an attached ::AMTStepProfile are profiled (see AMTSPAttach()). The duration is the CPU
+ * time of the step: the time the task is blocked or preempted during the step is not counted. For this the
+ * profiler is notified of the context switches with AMTSPOnTaskSwitchedIn() and AMTSPOnTaskSwitchedOut(),
+ * that the application calls from the FreeRTOS trace macros in FreeRTOSConfig.h:
+ *
+ *     #define traceTASK_SWITCHED_IN()   AMTSPOnTaskSwitchedIn(pxCurrentTCB)
+ *     #define traceTASK_SWITCHED_OUT()  AMTSPOnTaskSwitchedOut()
+ *
+ * A context switch in the few instructions at the begin or at the end of a step can be counted as CPU time.
+ * All durations are in microseconds.
+ *
+ * The statistics are updated by the profiled task without a critical section: a reader retries the copy
+ * if the task updated them in the meantime (see AMTSPGetStats()).
+ *
+ * The profiler is enabled with AMT_CFG_ENABLE_STEP_PROFILER. When it is disabled the
+ * instrumentation macros expand to nothing.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_AMTSTEPPROFILER_H_
+#define INCLUDE_SERVICES_AMTSTEPPROFILER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "systp.h"
+#include "systypes.h"
+#include "syslowpower.h"
+#include "AManagedTask.h"
+#include "AManagedTask_vtbl.h"
+
+
+#ifndef AMTSP_CFG_MAX_PM_STATES
+/**
+ * Specifies the maximum number of states of the application PM state machine. By default it is the number
+ * of states of ::EPowerMode, so the maps of the task cover all the PM states of the application.
+ */
+#define AMTSP_CFG_MAX_PM_STATES               ((uint8_t)E_POWER_MODE_NONE)
+#endif
+
+/**
+ * Number of bins of the histogram of the step duration. The bin 0 counts the
+ * steps shorter than 1 us, the bin n counts the steps in [2^(n-1), 2^n) us,
+ * and the last bin counts all the longer steps.
+ */
+#ifndef AMTSP_CFG_HISTOGRAM_BINS
+#define AMTSP_CFG_HISTOGRAM_BINS              16U
+#endif
+
+
+/**
+ * Create a type name for _AMTStepStats.
+ */
+typedef struct _AMTStepStats AMTStepStats;
+
+/**
+ * Statistics of the step duration in a power mode.
+ */
+struct _AMTStepStats {
+  /**
+   * Specifies the number of steps.
+   */
+  uint32_t nCount;
+
+  /**
+   * Specifies the minimum duration in us.
+   */
+  uint32_t nMin;
+
+  /**
+   * Specifies the maximum duration in us.
+   */
+  uint32_t nMax;
+
+  /**
+   * Specifies the sum of the durations in us. It is used to compute the mean.
+   */
+  uint64_t nSum;
+
+  /**
+   * Specifies the number of steps longer than the budget.
+   */
+  uint32_t nOverBudgetCount;
+
+  /**
+   * Specifies the histogram of the duration. See ::AMTSP_CFG_HISTOGRAM_BINS.
+   */
+  uint32_t nHistogram[AMTSP_CFG_HISTOGRAM_BINS];
+};
+
+/**
+ * Create a type name for _AMTStepProfile.
+ */
+typedef struct _AMTStepProfile AMTStepProfile;
+
+/**
+ * Profile of a managed task. The application allocates it, and the profiler owns it after AMTSPAttach().
+ */
+struct _AMTStepProfile {
+  /**
+   * Specifies a map (PM_STATE, budget in us). A budget equal to zero means no budget. It can be NULL.
+   */
+  const uint32_t *pnPMState2BudgetMap;
+
+  /**
+   * Specifies the profiled task.
+   */
+  AManagedTask *pxTask;
+
+  /**
+   * Specifies the timestamp when the task started, or resumed, the execution of the current step.
+   */
+  uint32_t nStepStart;
+
+  /**
+   * Specifies the cycles spent by the task in the current step before it has been switched out.
+   */
+  uint32_t nStepCycles;
+
+  /**
+   * Specifies the next profile in the list of the steps interrupted by a context switch.
+   */
+  struct _AMTStepProfile *pxNextSwitchedOut;
+
+  /**
+   * Specifies a sequence number incremented before and after each update of ::xStats. It is odd while
+   * the statistics are updated.
+   */
+  volatile uint32_t nSeq;
+
+  /**
+   * Set by AMTSPReset(). The statistics are cleared by the task at the end of the next step.
+   */
+  volatile uint8_t nResetPending;
+
+  /**
+   * Specifies the statistics of each power mode of the task (that is after the remap).
+   */
+  AMTStepStats xStats[AMTSP_CFG_MAX_PM_STATES];
+};
+
+
+#if (AMT_CFG_ENABLE_STEP_PROFILER == 1)
+
+#define AMTSP_STEP_BEGIN(task)                AMTSPStepBegin((AManagedTask*)(task))
+#define AMTSP_STEP_END(task, pm_state)        AMTSPStepEnd((AManagedTask*)(task), (pm_state))
+
+// Public API declaration
+//***********************
+
+/**
+ * Attach a profile to a managed task and clear its statistics. It must be called after the task initialization
+ * (AMTInit() or AMTInitEx()).
+ *
+ * @param pxTask [IN] specifies a task.
+ * @param pxProfile [IN] specifies the profile of the task. It must be valid for the life time of the task.
+ * @param pnPMState2BudgetMap [IN] specifies a map (PM_STATE, budget in us). It can be NULL.
+ * @return SYS_NO_ERROR_CODE
+ */
+sys_error_code_t AMTSPAttach(AManagedTask *pxTask, AMTStepProfile *pxProfile, const uint32_t *pnPMState2BudgetMap);
+
+/**
+ * Start the measure of a step. It is used by the task control loop.
+ *
+ * @param pxTask [IN] specifies a task.
+ */
+void AMTSPStepBegin(AManagedTask *pxTask);
+
+/**
+ * Stop the measure of a step and update the statistics. It is used by the task control loop.
+ *
+ * @param pxTask [IN] specifies a task.
+ * @param nPMState [IN] specifies the power mode of the task (that is after the remap).
+ */
+void AMTSPStepEnd(AManagedTask *pxTask, uint8_t nPMState);
+
+/**
+ * Notify the profiler that a task is switched in. It is called from the FreeRTOS traceTASK_SWITCHED_IN() macro.
+ *
+ * @param pvTCB [IN] specifies the TCB of the task, that is its handle.
+ */
+void AMTSPOnTaskSwitchedIn(const void *pvTCB);
+
+/**
+ * Notify the profiler that the running task is switched out. It is called from the FreeRTOS
+ * traceTASK_SWITCHED_OUT() macro.
+ */
+void AMTSPOnTaskSwitchedOut(void);
+
+/**
+ * Get a copy of the statistics of a task in a power mode. It can be called from any task, but not from an ISR:
+ * if the task is updating its statistics the caller waits one tick.
+ *
+ * @param pxTask [IN] specifies a task.
+ * @param ePowerMode [IN] specifies a power mode of the task (that is after the remap).
+ * @param pxStats [OUT] specifies the statistics.
+ * @return SYS_NO_ERROR_CODE if success, SYS_INVALID_PARAMETER_ERROR_CODE if the task has no profile.
+ */
+sys_error_code_t AMTSPGetStats(AManagedTask *pxTask, EPowerMode ePowerMode, AMTStepStats *pxStats);
+
+/**
+ * Get the mean of the step duration.
+ *
+ * @param pxStats [IN] specifies the statistics of a power mode.
+ * @return the mean duration in us.
+ */
+uint32_t AMTSPGetMean(const AMTStepStats *pxStats);
+
+/**
+ * Get the upper bound of the histogram bin that contains a percentile of the step duration.
+ * For example AMTSPGetPercentile(&xStats, 99) returns a duration D such that at least 99% of the steps
+ * are shorter than D.
+ *
+ * @param pxStats [IN] specifies the statistics of a power mode.
+ * @param nPercent [IN] specifies the percentile in [1, 100].
+ * @return the upper bound in us of the bin, or UINT32_MAX if the percentile is in the last bin.
+ */
+uint32_t AMTSPGetPercentile(const AMTStepStats *pxStats, uint8_t nPercent);
+
+/**
+ * Clear the statistics of a task. The statistics are cleared by the task at the end of its next step.
+ *
+ * @param pxTask [IN] specifies a task.
+ */
+void AMTSPReset(AManagedTask *pxTask);
+
+#else
+
+#define AMTSP_STEP_BEGIN(task)
+#define AMTSP_STEP_END(task, pm_state)
+
+#endif /* AMT_CFG_ENABLE_STEP_PROFILER */
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_AMTSTEPPROFILER_H_ */
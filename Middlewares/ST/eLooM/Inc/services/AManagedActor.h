@@ -0,0 +1,149 @@
+/**
+ ******************************************************************************
+ * @file    AManagedActor.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Lightweight managed task hosted by an ::ActorExecutor.
+ *
+ * An actor has a (PM_STATE, step function) map like an ::AManagedTask, but it has no FreeRTOS task
+ * and no stack. Many actors share the task of an ::ActorExecutor that executes their steps cooperatively,
+ * so a step must not block: it does a short piece of work and returns.
+ * An actor step is executed when the actor is ready. An actor becomes ready with AMAPost(), for example
+ * from an ISR or a FreeRTOS software timer, and it is ready once at the start of the executor.
+ * The executor forwards to the actors the power mode transactions and the errors.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_AMANAGEDACTOR_H_
+#define INCLUDE_SERVICES_AMANAGEDACTOR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "systp.h"
+#include "systypes.h"
+#include "syserror.h"
+#include "syslowpower.h"
+#include "events/sysevent.h"
+#include "FreeRTOS.h"
+
+
+/**
+ * Create  type name for _AManagedActor.
+ */
+typedef struct _AManagedActor AManagedActor;
+
+/**
+ * Create a type name for the step execution function of an actor.
+ */
+typedef sys_error_code_t (ActorStepFunc_t)(AManagedActor *_this);
+
+/**
+ * Create a type name for a pointer to a step execution function of an actor.
+ */
+typedef sys_error_code_t (*pActorStepFunc_t)(AManagedActor *_this);
+
+
+// Public API declaration
+//***********************
+
+/**
+ * Initialize an actor structure. The application is responsible to allocate
+ * an actor in memory. This method must be called after the allocation.
+ *
+ * @param _this [IN] specifies an actor object pointer.
+ * @return \a SYS_NO_ERROR_CODE
+ */
+inline sys_error_code_t AMAInit(AManagedActor *_this);
+
+/**
+ * Initialize the hardware resource used by the actor. It is called by the executor in its AMTHardwareInit().
+ *
+ * @param _this [IN] specifies an actor object pointer.
+ * @param pParams [IN] specifies the parameters of the executor.
+ * @return SYS_NO_ERROR_CODE if success, an error code otherwise.
+ */
+inline sys_error_code_t AMAHardwareInit(AManagedActor *_this, void *pParams);
+
+/**
+ * Actor specific function called by the executor during a power mode transaction, as AMTDoEnterPowerMode().
+ * The power modes are remapped with the actor map, if any.
+ *
+ * @param _this [IN] specifies an actor object pointer.
+ * @param eActivePowerMode [IN] specifies the current power mode of the system.
+ * @param eNewPowerMode [IN] specifies the new power mode that is to be activated by the system.
+ * @return SYS_NO_ERROR_CODE if success, an error code otherwise.
+ */
+inline sys_error_code_t AMADoEnterPowerMode(AManagedActor *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
+
+/**
+ * Called by the executor to notify a system level error, as AMTHandleError().
+ *
+ * @param _this [IN] specifies an actor object pointer.
+ * @param xError [IN] specifies an error event.
+ * @return SYS_NO_ERROR_CODE if success, an error code otherwise.
+ */
+inline sys_error_code_t AMAHandleError(AManagedActor *_this, SysEvent xError);
+
+/**
+ * Actor specific one time initialization, executed in the executor task before the first step,
+ * as AMTOnEnterTaskControlLoop().
+ *
+ * @param _this [IN] specifies an actor object pointer.
+ * @return SYS_NO_ERROR_CODE if success, an error code otherwise.
+ */
+inline sys_error_code_t AMAOnEnterControlLoop(AManagedActor *_this);
+
+/**
+ * Get the step function of the actor in a power mode of the system. The power mode is remapped with the
+ * actor map, if any.
+ *
+ * @param _this [IN] specifies an actor object pointer.
+ * @param ePowerMode [IN] specifies a power mode of the system.
+ * @return the step function, or NULL if the actor has no step in that power mode.
+ */
+inline pActorStepFunc_t AMAGetStepFunc(AManagedActor *_this, EPowerMode ePowerMode);
+
+/**
+ * Set the actor as ready and wake up its executor. The actor step is executed once for every sequence of posts
+ * before its execution. It must not be called from an ISR.
+ *
+ * @param _this [IN] specifies an actor object pointer.
+ */
+inline void AMAPost(AManagedActor *_this);
+
+/**
+ * ISR version of AMAPost().
+ *
+ * @param _this [IN] specifies an actor object pointer.
+ * @param pxHigherPriorityTaskWoken [OUT] set to `pdTRUE` if the executor has a priority higher than the interrupted task.
+ */
+inline void AMAPostFromISR(AManagedActor *_this, BaseType_t *pxHigherPriorityTaskWoken);
+
+/**
+ * Get the number of steps of the actor that returned an error.
+ *
+ * @param _this [IN] specifies an actor object pointer.
+ * @return the number of errors, saturated to ::MT_MAX_ERROR_COUNT.
+ */
+inline uint8_t AMAGetErrorCount(AManagedActor *_this);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_AMANAGEDACTOR_H_ */
@@ -0,0 +1,186 @@
+/**
+ ******************************************************************************
+ * @file    AManagedActor_vtbl.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief
+ *
+ * TODO - insert here the file description
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_AMANAGEDACTOR_VTBL_H_
+#define INCLUDE_SERVICES_AMANAGEDACTOR_VTBL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "AManagedActor.h"
+#include "AManagedTaskEx.h"
+#include "AManagedTaskEx_vtbl.h"
+#include "task.h"
+
+
+/**
+ * Create  type name for _AManagedActor_vtbl.
+ */
+typedef struct _AManagedActor_vtbl AManagedActor_vtbl;
+
+struct _AManagedActor_vtbl {
+  sys_error_code_t (*HardwareInit)(AManagedActor *_this, void *pParams);
+  sys_error_code_t (*DoEnterPowerMode)(AManagedActor *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
+  sys_error_code_t (*HandleError)(AManagedActor *_this, SysEvent xError);
+  sys_error_code_t (*OnEnterControlLoop)(AManagedActor *_this);
+};
+
+/**
+ * An actor is a step function map executed in the task of an ::ActorExecutor.
+ * All the actors of an executor belong to a linked list.
+ */
+struct _AManagedActor {
+  /**
+   * Specifies  a pointer to the class virtual table.
+   */
+  const AManagedActor_vtbl *vptr;
+
+  /**
+   * Specifies a pointer to the next actor of the executor.
+   */
+  struct _AManagedActor *m_pNext;
+
+  /**
+   * Specifies the executor of the actor, or NULL if the actor has not been added to an executor.
+   */
+  AManagedTaskEx *m_pxExecutor;
+
+  /**
+   * Specifies a map (PM_STATE, ActorStepFunc) between each application PM state and the associated step function.
+   */
+  const pActorStepFunc_t *m_pfPMState2FuncMap;
+
+  /**
+   * @see ::AMAnagedTask::m_pPMState2PMStateMap
+   */
+  const EPowerMode *m_pPMState2PMStateMap;
+
+  /**
+   * `TRUE` if the step of the actor must be executed.
+   */
+  volatile boolean_t m_bIsReady;
+
+  /**
+   * Specifies the number of steps that returned an error.
+   */
+  uint8_t m_nErrorCount;
+};
+
+
+// Inline functions definition
+// ***************************
+
+SYS_DEFINE_INLINE
+sys_error_code_t AMAInit(AManagedActor *_this) {
+  assert_param(_this != NULL);
+
+  _this->m_pNext = NULL;
+  _this->m_pxExecutor = NULL;
+  _this->m_pfPMState2FuncMap = NULL;
+  _this->m_pPMState2PMStateMap = NULL;
+  _this->m_bIsReady = TRUE;
+  _this->m_nErrorCount = 0;
+
+  return SYS_NO_ERROR_CODE;
+}
+
+SYS_DEFINE_INLINE
+sys_error_code_t AMAHardwareInit(AManagedActor *_this, void *pParams) {
+  return _this->vptr->HardwareInit(_this, pParams);
+}
+
+SYS_DEFINE_INLINE
+sys_error_code_t AMADoEnterPowerMode(AManagedActor *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode) {
+  assert_param(_this != NULL);
+  EPowerMode eObjeActivePowerMode = eActivePowerMode;
+  EPowerMode eObjNewPowerMode = eNewPowerMode;
+
+  if (_this->m_pPMState2PMStateMap != NULL) {
+    /* remap the PM states. */
+    eObjeActivePowerMode = _this->m_pPMState2PMStateMap[(uint8_t)eActivePowerMode];
+    eObjNewPowerMode = _this->m_pPMState2PMStateMap[(uint8_t)eNewPowerMode];
+  }
+
+  return _this->vptr->DoEnterPowerMode(_this, eObjeActivePowerMode, eObjNewPowerMode);
+}
+
+SYS_DEFINE_INLINE
+sys_error_code_t AMAHandleError(AManagedActor *_this, SysEvent xError) {
+  return _this->vptr->HandleError(_this, xError);
+}
+
+SYS_DEFINE_INLINE
+sys_error_code_t AMAOnEnterControlLoop(AManagedActor *_this) {
+  return _this->vptr->OnEnterControlLoop(_this);
+}
+
+SYS_DEFINE_INLINE
+pActorStepFunc_t AMAGetStepFunc(AManagedActor *_this, EPowerMode ePowerMode) {
+  assert_param(_this != NULL);
+  pActorStepFunc_t pfStep = NULL;
+
+  if (_this->m_pfPMState2FuncMap != NULL) {
+    if (_this->m_pPMState2PMStateMap != NULL) {
+      /* remap the PM states. */
+      ePowerMode = _this->m_pPMState2PMStateMap[(uint8_t)ePowerMode];
+    }
+    pfStep = _this->m_pfPMState2FuncMap[(uint8_t)ePowerMode];
+  }
+
+  return pfStep;
+}
+
+SYS_DEFINE_INLINE
+void AMAPost(AManagedActor *_this) {
+  assert_param(_this != NULL);
+
+  _this->m_bIsReady = TRUE;
+  if ((_this->m_pxExecutor != NULL) && (_this->m_pxExecutor->m_xThaskHandle != NULL)) {
+    (void)xTaskNotifyGive(_this->m_pxExecutor->m_xThaskHandle);
+  }
+}
+
+SYS_DEFINE_INLINE
+void AMAPostFromISR(AManagedActor *_this, BaseType_t *pxHigherPriorityTaskWoken) {
+  assert_param(_this != NULL);
+
+  _this->m_bIsReady = TRUE;
+  if ((_this->m_pxExecutor != NULL) && (_this->m_pxExecutor->m_xThaskHandle != NULL)) {
+    vTaskNotifyGiveFromISR(_this->m_pxExecutor->m_xThaskHandle, pxHigherPriorityTaskWoken);
+  }
+}
+
+SYS_DEFINE_INLINE
+uint8_t AMAGetErrorCount(AManagedActor *_this) {
+  assert_param(_this != NULL);
+
+  return _this->m_nErrorCount;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* INCLUDE_SERVICES_AMANAGEDACTOR_VTBL_H_ */
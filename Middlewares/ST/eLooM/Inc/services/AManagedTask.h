@@ -43,6 +43,21 @@ extern "C" {
 #define MT_ALLOWED_ERROR_COUNT   0x2U
 #endif
 
+#ifndef AMT_CFG_ENABLE_STATUS_BENCHMARK
+/**
+ * If defined to 1 the function AMTStatusBenchmark() is available to measure the cost of the task step handshake.
+ * It requires the DWT cycle counter.
+ */
+#define AMT_CFG_ENABLE_STATUS_BENCHMARK   0
+#endif
+
+#ifndef AMT_CFG_ENABLE_STEP_PROFILER
+/**
+ * If defined to 1 the task control loops measure the duration of the steps (see AMTStepProfiler.h).
+ */
+#define AMT_CFG_ENABLE_STEP_PROFILER      0
+#endif
+
 
 /**
  * Create  type name for _AManagedTask.
@@ -129,9 +144,10 @@ inline sys_error_code_t AMTOnEnterTaskControlLoop(AManagedTask *_this);
 /**
  * Initialize a managed task structure. The application is responsible to allocate
  * a managed task in memory. This method must be called after the allocation.
+ * It creates the semaphore used by INIT to resume the task (see AMTResume()).
  *
  * @param _this [IN] specifies a task object pointer.
- * @return \a SYS_NO_ERROR_CODE
+ * @return \a SYS_NO_ERROR_CODE if success, \a SYS_OUT_OF_MEMORY_ERROR_CODE if the semaphore cannot be created.
  */
 inline sys_error_code_t AMTInit(AManagedTask *_this);
 
@@ -196,6 +212,94 @@ inline void AMTResetAEDCounter(AManagedTask *_this);
  */
 inline boolean_t AMTIsPowerModeSwitchPending(AManagedTask *_this);
 
+/**
+ * Check if a power mode transaction of the system changes the power mode of the managed task.
+ * When the task (PMState, PMState) map remaps the current and the new power mode of the system
+ * in the same task power mode, then the task is not involved in the transaction and the INIT task
+ * does not suspend it.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @param eActivePowerMode [IN] specifies the current power mode of the system.
+ * @param eNewPowerMode [IN] specifies the new power mode that is to be activated by the system.
+ * @return `TRUE` if the task power mode changes, `FALSE` otherwise.
+ */
+inline boolean_t AMTIsPowerModeSwitchRequired(AManagedTask *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
+
+/**
+ * Used by the task control loop when there is a pending power mode switch. The task clears the
+ * `nDelayPowerModeSwitch` flag, notifies INIT, and waits on its resume semaphore until INIT clears
+ * the `nPowerModeSwitchPending` flag and resumes it with AMTResume().
+ * No critical section is held while the task blocks: a resume given before the task blocks is not lost,
+ * and the flag is checked again after every resume.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ */
+void AMTWaitPowerModeSwitch(AManagedTask *_this);
+
+/**
+ * Used by the task control loop when there is no step function for the current power mode. The task waits
+ * on its resume semaphore until it has a step function, or until a power mode switch is pending.
+ * The `nDelayPowerModeSwitch` flag must be cleared by the caller.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ */
+void AMTWaitStepFunction(AManagedTask *_this);
+
+/**
+ * Used by INIT to resume a task waiting in AMTWaitPowerModeSwitch() or AMTWaitStepFunction().
+ * It gives the resume semaphore of the task, so the task notification is free for the application.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ */
+inline void AMTResume(AManagedTask *_this);
+
+/**
+ * Atomically replace the status of a managed task, if it has not been modified since it was read.
+ * It is the building block of the other status functions.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @param nExpectedStatus [IN] specifies the raw status read by the caller.
+ * @param nNewStatus [IN] specifies the new raw status.
+ * @return `TRUE` if the status has been replaced, `FALSE` if it has been modified in the meantime.
+ */
+boolean_t AMTStatusCompareAndSwap(AManagedTask *_this, uint8_t nExpectedStatus, uint8_t nNewStatus);
+
+/**
+ * Atomically clear and set some bits of the status of a managed task (see AMT_STATUS_xxx_Msk).
+ * The task and INIT use this function to update the status without a critical section.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @param nClearMask [IN] specifies the bits to clear.
+ * @param nSetMask [IN] specifies the bits to set.
+ * @return the raw status before the update.
+ */
+inline uint8_t AMTStatusModify(AManagedTask *_this, uint8_t nClearMask, uint8_t nSetMask);
+
+/**
+ * Used by the task control loop before a step execution. If there is no pending power mode switch,
+ * it sets the `nDelayPowerModeSwitch` flag, otherwise the status is not modified. The check and the
+ * update are atomic, so INIT cannot request a power mode switch in between.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @return `TRUE` if the power mode switch has been delayed, `FALSE` if there is a pending power mode switch.
+ */
+inline boolean_t AMTStatusTryDelayPowerModeSwitch(AManagedTask *_this);
+
+#if (AMT_CFG_ENABLE_STATUS_BENCHMARK == 1)
+/**
+ * Measure the average number of CPU cycles spent by the task control loop to delay and release the power
+ * mode switch around one step: with two critical sections, as done before the lock-free status,
+ * and with AMTStatusTryDelayPowerModeSwitch() and AMTStatusModify().
+ * It must be called by the task that owns `_this`, when there is no power mode switch in progress.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @param nIterations [IN] specifies the number of handshakes to measure. It must be greater than zero.
+ * @param pnCriticalSectionCycles [OUT] specifies the average cycles of the handshake based on the critical sections.
+ * @param pnAtomicCycles [OUT] specifies the average cycles of the lock-free handshake.
+ */
+void AMTStatusBenchmark(AManagedTask *_this, uint32_t nIterations, uint32_t *pnCriticalSectionCycles, uint32_t *pnAtomicCycles);
+#endif
+
 /**
  * Set the PM state remapping function for a managed task object. It is used by the application to re-map the behavior of an ::AManagedTask
  * during a power mode switch. Image a developer that want to use an existing managed task (MyManagedTask1) in a new application. Probably
@@ -213,6 +317,11 @@ inline sys_error_code_t AMTSetPMStateRemapFunc(AManagedTask *_this, EPowerMode *
 
 /**
  * This is the default control loop of a managed task.
+ * When there is no step function for the current power mode the task waits on its resume semaphore. INIT resumes it
+ * at the end of the power mode switch to a state mapped to a step function. The application can wake it up
+ * with AMTResume(): the task checks again the step function of its power mode.
+ * The framework does not use the task notification of a managed task, so a step function can wait on it.
+ *
  * @param pParams [IN] specify a pointer to the task object:
  * AManagedTask *pTask = (AManagedTask*)pParams;
  */
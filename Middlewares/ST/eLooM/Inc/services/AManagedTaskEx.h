@@ -39,6 +39,8 @@ typedef struct _AManagedTaskEx AManagedTaskEx;
 /**
  * Power mode classes. An ::AManagedTaskEx can belong to only one power mode class.
  * An ::AManagedTask belong, by default, to E_PM_CLASS_0.
+ * The application can use up to ::AMT_PM_CLASS_COUNT classes. A class not listed here is obtained with a cast,
+ * for example `(EPMClass)3`.
  */
 typedef enum _EPMClass {
   E_PM_CLASS_0 = 0, /**< E_PM_CLASS_0 - this class is for backward compatibility. A managed task belonging to this class execute the power mode switch as in eLooM v2.*/
@@ -46,6 +48,17 @@ typedef enum _EPMClass {
   E_PM_CLASS_2 = 2  /**< E_PM_CLASS_2 - a managed task belonging to this class is delayed during a PM transaction until all task belonging to E_PM_CLASS_0 and E_PM_CLASS_1  did the transaction. */
 } EPMClass;
 
+#ifndef AMT_PM_CLASS_COUNT
+/**
+ * Specifies the number of power mode classes. It can be redefined in the sysconfig.h file.
+ */
+#define AMT_PM_CLASS_COUNT              3U
+#endif
+
+#if (AMT_PM_CLASS_COUNT > 16U) || (AMT_PM_CLASS_COUNT < 1U)
+#error AMT_PM_CLASS_COUNT must be in the range [1, 16]
+#endif
+
 
 // Public API declaration
 //***********************
@@ -53,9 +66,10 @@ typedef enum _EPMClass {
 /**
  * Initialize a managed task structure. The application is responsible to allocate
  * a managed task in memory. This method must be called after the allocation.
+ * It creates the semaphore used by INIT to resume the task (see AMTResume()).
  *
  * @param _this [IN] specifies a task object pointer.
- * @return \a SYS_NO_ERROR_CODE
+ * @return \a SYS_NO_ERROR_CODE if success, \a SYS_OUT_OF_MEMORY_ERROR_CODE if the semaphore cannot be created.
  */
 inline sys_error_code_t AMTInitEx(AManagedTaskEx *_this);
 
@@ -119,12 +133,44 @@ inline boolean_t AMTExIsTaskInactive(AManagedTaskEx *_this);
  * dynamically set the PM Class for the application task. In this way it is possible to control the of the task
  * executing the transaction during a power mode switch.
  *
+ * If the task has been already added to an ::_ApplicationContext, then the task is moved in the bucket
+ * of the new PM class by INIT (see SysSetTaskPMClass()). When the function is called by INIT, for example from
+ * AMTExOnEnterPowerMode(), the task is moved immediately. Otherwise the new PM class is applied by INIT after
+ * the running power mode transaction, if any.
+ *
  * @param _this [IN] specifies a pointer to the object.
- * @param eNewPMClass [IN] specifies the new PM class for the task.
- * @return SYS_NO_ERROR_CODE
+ * @param eNewPMClass [IN] specifies the new PM class for the task. It must be less than ::AMT_PM_CLASS_COUNT.
+ * @return SYS_NO_ERROR_CODE if success, SYS_INVALID_PARAMETER_ERROR_CODE if the PM class is not valid,
+ *         or the error codes of SysSetTaskPMClass().
  */
 inline sys_error_code_t AMTExSetPMClass(AManagedTaskEx *_this, EPMClass eNewPMClass);
 
+/**
+ * Set the list of tasks that must complete the PM transaction before this task. During a PM transaction
+ * a task starts its transaction as soon as all its dependencies, and all the tasks of the lower PM classes,
+ * did the transaction, so independent tasks in the same PM class do not wait for each other.
+ * A dependency that is not affected by the PM transaction is considered done. A dependency belonging to a higher
+ * PM class, or a cycle in the dependencies, is reported by the INIT task (see ::SysPMDependencyBreak) and only
+ * the offending dependency is ignored for the rest of the PM transaction.
+ *
+ * @param _this [IN] specifies a pointer to the object.
+ * @param pxDependencies [IN] specifies an array of managed tasks. The array is not copied, so it must be valid
+ *                            for the life time of the task. It can be NULL to remove all dependencies.
+ * @param nDependencies [IN] specifies the number of items in pxDependencies.
+ * @return SYS_NO_ERROR_CODE
+ */
+inline sys_error_code_t AMTExSetPMDependencies(AManagedTaskEx *_this, AManagedTask *const *pxDependencies, uint8_t nDependencies);
+
+/**
+ * Check if all the dependencies of the managed task did the PM transaction.
+ *
+ * @param _this [IN] specifies a pointer to the object.
+ * @param eActivePowerMode [IN] specifies the current power mode of the system.
+ * @param eNewPowerMode [IN] specifies the new power mode that is to be activated by the system.
+ * @return `TRUE` if the task can start the PM transaction, `FALSE` otherwise.
+ */
+inline boolean_t AMTExArePMDependenciesDone(AManagedTaskEx *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
+
 /**
  * Get the Power Mode Class of the managed task.
  * @param _this [IN] specifies a pointer to the object.
@@ -56,9 +56,9 @@ struct _AManagedTaskEx_vtbl {
  */
 typedef struct _AMTStatusEx {
   uint8_t nIsWaitingNoTimeout : 1;
-  uint8_t nPowerModeClass: 2;
+  uint8_t nPowerModeClass: 4;
 
-  uint8_t nUnused: 4;
+  uint8_t nUnused: 2;
   uint8_t nReserved : 1;
 } AMTStatusEx;
 
@@ -82,6 +82,16 @@ struct _AManagedTaskEx {
    */
   struct _AManagedTaskEx *m_pNext;
 
+  /**
+   * @see ::AMAnagedTask::m_pNextInPMClass
+   */
+  struct _AManagedTaskEx *m_pNextInPMClass;
+
+  /**
+   * @see ::AMAnagedTask::m_pxContext
+   */
+  struct _ApplicationContext *m_pxContext;
+
   /**
    * Specifies a map (PM_STATE, ExecuteStepFunc) between each application PM state and the associated step function.
    * If the pointer
@@ -98,13 +108,43 @@ struct _AManagedTaskEx {
    */
   AMTStatus m_xStatus;
 
+#if (AMT_CFG_ENABLE_STEP_PROFILER == 1)
+  /**
+   * @see ::AMAnagedTask::m_pxStepProfile
+   */
+  struct _AMTStepProfile *m_pxStepProfile;
+#endif
+
+  /**
+   * @see ::AMAnagedTask::m_xResumeSem
+   */
+  SemaphoreHandle_t m_xResumeSem;
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+  /**
+   * @see ::AMAnagedTask::m_xResumeSemBuffer
+   */
+  StaticSemaphore_t m_xResumeSemBuffer;
+#endif
+
   /**
    * Extended status flags.
    */
   AMTStatusEx m_xStatusEx;
+
+  /**
+   * Specifies the number of items in ::m_pxPMDependencies.
+   */
+  uint8_t m_nPMDependencies;
+
+  /**
+   * Specifies the tasks that must complete the PM transaction before this task. It can be NULL.
+   */
+  AManagedTask *const *m_pxPMDependencies;
 };
 
 extern EPowerMode SysGetPowerMode(void);
+extern sys_error_code_t SysSetTaskPMClass(AManagedTask *pxTask, EPMClass eNewPMClass);
 
 // Inline functions definition
 // ***************************
@@ -141,6 +181,8 @@ SYS_DEFINE_INLINE
 sys_error_code_t AMTInitEx(AManagedTaskEx *_this) {
 
   _this->m_pNext = NULL;
+  _this->m_pNextInPMClass = NULL;
+  _this->m_pxContext = NULL;
   _this->m_xThaskHandle = NULL;
   _this->m_pfPMState2FuncMap = NULL;
   _this->m_pPMState2PMStateMap = NULL;
@@ -150,10 +192,25 @@ sys_error_code_t AMTInitEx(AManagedTaskEx *_this) {
   _this->m_xStatus.nIsTaskStillRunning = 0;
   _this->m_xStatus.nErrorCount = 0;
   _this->m_xStatus.nReserved = 1; // this identifies the task as an AManagedTaskEx.
+#if (AMT_CFG_ENABLE_STEP_PROFILER == 1)
+  _this->m_pxStepProfile = NULL;
+#endif
   _this->m_xStatusEx.nIsWaitingNoTimeout = 0;
   _this->m_xStatusEx.nPowerModeClass = E_PM_CLASS_0;
   _this->m_xStatusEx.nUnused = 0;
   _this->m_xStatusEx.nReserved = 0;
+  _this->m_nPMDependencies = 0;
+  _this->m_pxPMDependencies = NULL;
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+  _this->m_xResumeSem = xSemaphoreCreateBinary();
+#else
+  _this->m_xResumeSem = xSemaphoreCreateBinaryStatic(&_this->m_xResumeSemBuffer);
+#endif
+  if (_this->m_xResumeSem == NULL) {
+    SYS_SET_SERVICE_LEVEL_ERROR_CODE(SYS_OUT_OF_MEMORY_ERROR_CODE);
+    return SYS_OUT_OF_MEMORY_ERROR_CODE;
+  }
 
   return SYS_NO_ERROR_CODE;
 }
@@ -177,12 +234,52 @@ boolean_t AMTExIsTaskInactive(AManagedTaskEx *_this){
 SYS_DEFINE_INLINE
 sys_error_code_t AMTExSetPMClass(AManagedTaskEx *_this, EPMClass eNewPMClass) {
   assert_param(_this);
+  assert_param((uint8_t)eNewPMClass < AMT_PM_CLASS_COUNT);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+
+  if ((uint8_t)eNewPMClass >= AMT_PM_CLASS_COUNT) {
+    /* the application context has a bucket only for the first AMT_PM_CLASS_COUNT classes.*/
+    xRes = SYS_INVALID_PARAMETER_ERROR_CODE;
+    SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+  }
+  else if (_this->m_pxContext == NULL) {
+    _this->m_xStatusEx.nPowerModeClass = eNewPMClass;
+  }
+  else if ((EPMClass)_this->m_xStatusEx.nPowerModeClass != eNewPMClass) {
+    /* INIT walks the PM class buckets of the application context, so it is the only one that moves the task.*/
+    xRes = SysSetTaskPMClass((AManagedTask*)_this, eNewPMClass);
+  }
+
+  return xRes;
+}
+
+SYS_DEFINE_INLINE
+sys_error_code_t AMTExSetPMDependencies(AManagedTaskEx *_this, AManagedTask *const *pxDependencies, uint8_t nDependencies) {
+  assert_param(_this);
+  assert_param((pxDependencies != NULL) || (nDependencies == 0U));
 
-  _this->m_xStatusEx.nPowerModeClass = eNewPMClass;
+  _this->m_pxPMDependencies = pxDependencies;
+  _this->m_nPMDependencies = pxDependencies != NULL ? nDependencies : 0U;
 
   return SYS_NO_ERROR_CODE;
 }
 
+SYS_DEFINE_INLINE
+boolean_t AMTExArePMDependenciesDone(AManagedTaskEx *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode) {
+  assert_param(_this);
+  boolean_t bRes = TRUE;
+  AManagedTask *pxDependency;
+
+  for (uint8_t i = 0; (i < _this->m_nPMDependencies) && bRes; ++i) {
+    pxDependency = _this->m_pxPMDependencies[i];
+    if ((pxDependency->m_xStatus.nPowerModeSwitchDone == 0U) && AMTIsPowerModeSwitchRequired(pxDependency, eActivePowerMode, eNewPowerMode)) {
+      bRes = FALSE;
+    }
+  }
+
+  return bRes;
+}
+
 SYS_DEFINE_INLINE
 EPMClass AMTExGetPMClass(AManagedTaskEx *_this) {
   assert_param(_this);
@@ -32,6 +32,7 @@ extern "C" {
 #include "systp.h"
 #include "FreeRTOS.h"
 #include "task.h"
+#include "semphr.h"
 
 /**
  * Create  type name for _IManagedTask_vtb.
@@ -46,39 +47,60 @@ struct _AManagedTask_vtbl {
   sys_error_code_t (*OnEnterTaskControlLoop)(AManagedTask *_this);
 };
 
+/**
+ * Bit masks of the ::AMTStatus fields. The ARM EABI allocates the bit fields starting from the LSB.
+ */
+#define AMT_STATUS_DELAY_PM_SWITCH_Msk        0x01U
+#define AMT_STATUS_PM_SWITCH_PENDING_Msk      0x02U
+#define AMT_STATUS_PM_SWITCH_DONE_Msk         0x04U
+#define AMT_STATUS_IS_STILL_RUNNING_Msk       0x08U
+#define AMT_STATUS_ERROR_COUNT_Pos            4U
+#define AMT_STATUS_ERROR_COUNT_Msk            0x70U
+
 /**
  * Managed Task status field. This data is used to coordinate the power mode switch between the INIT task
  * and the application managed tasks.
+ * The task and INIT modify the status concurrently, so, after the initialization, the status must be modified
+ * only with AMTStatusModify() or AMTStatusTryDelayPowerModeSwitch(). They update the status with an atomic
+ * read-modify-write, without a critical section.
  */
-typedef struct _AMTStatus {
-  /**
-   * Set by task to delay a power mode switch. This allow a task to complete a step in its control loop
-   * and put the task in a safe state before the power mode transaction.
-   */
-  uint8_t nDelayPowerModeSwitch: 1;
-
-  /**
-   * Set by INIT to signal a task about a pending power mode switch.
-   */
-  uint8_t nPowerModeSwitchPending: 1;
+typedef union _AMTStatus {
+  struct {
+    /**
+     * Set by task to delay a power mode switch. This allow a task to complete a step in its control loop
+     * and put the task in a safe state before the power mode transaction.
+     */
+    uint8_t nDelayPowerModeSwitch: 1;
+
+    /**
+     * Set by INIT to signal a task about a pending power mode switch.
+     */
+    uint8_t nPowerModeSwitchPending: 1;
+
+    /**
+     * SET by INIT to mark a task ready for the power mode switch.
+     * RESET by INIT at the end of teh power mode switch sequence.
+     */
+    uint8_t nPowerModeSwitchDone: 1;
+
+    /**
+     * Set by a managed task to notify the system that it is working fine. It is reset by the application error delegate.
+     * A task without a step function in its power mode does not set it while it waits in AMTWaitStepFunction().
+     */
+    uint8_t nIsTaskStillRunning: 1;
+
+    /**
+     * Count the error occurred during the task execution.
+     */
+    uint8_t nErrorCount: 3;
+
+    uint8_t nReserved : 1;
+  };
 
   /**
-   * SET by INIT to mark a task ready for the power mode switch.
-   * RESET by INIT at the end of teh power mode switch sequence.
+   * Raw value of the status, used for the atomic update.
    */
-  uint8_t nPowerModeSwitchDone: 1;
-
-  /**
-   * Set by a managed task to notify the system that it is working fine. It is reset by the application error delegate.
-   */
-  uint8_t nIsTaskStillRunning: 1;
-
-  /**
-   * Count the error occurred during the task execution.
-   */
-  uint8_t nErrorCount: 3;
-
-  uint8_t nReserved : 1;
+  uint8_t nRaw;
 } AMTStatus;
 
 /**
@@ -101,6 +123,16 @@ struct _AManagedTask {
    */
   struct _AManagedTask *m_pNext;
 
+  /**
+   * Specifies a pointer to the next managed task with the same power mode class in the _ApplicationContext.
+   */
+  struct _AManagedTask *m_pNextInPMClass;
+
+  /**
+   * Specifies the _ApplicationContext the task belongs to, or NULL if the task has not been added to a context.
+   */
+  struct _ApplicationContext *m_pxContext;
+
   /**
    * Specifies a map (PM_STATE, ExecuteStepFunc) between each application PM state and the associated step function.
    * If the pointer
@@ -121,6 +153,25 @@ struct _AManagedTask {
    * Status flags.
    */
   AMTStatus m_xStatus;
+
+#if (AMT_CFG_ENABLE_STEP_PROFILER == 1)
+  /**
+   * Specifies the step profile of the task, or NULL if the task is not profiled (see AMTSPAttach()).
+   */
+  struct _AMTStepProfile *m_pxStepProfile;
+#endif
+
+  /**
+   * Binary semaphore used by INIT to resume the task (see AMTResume()). The task notification is left to the application.
+   */
+  SemaphoreHandle_t m_xResumeSem;
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+  /**
+   * In static allocation mode the semaphore is allocated with the task object.
+   */
+  StaticSemaphore_t m_xResumeSemBuffer;
+#endif
 };
 
 extern EPowerMode SysGetPowerMode(void);
@@ -167,6 +218,8 @@ sys_error_code_t AMTOnEnterTaskControlLoop(AManagedTask *_this) {
 SYS_DEFINE_INLINE
 sys_error_code_t AMTInit(AManagedTask *_this) {
   _this->m_pNext = NULL;
+  _this->m_pNextInPMClass = NULL;
+  _this->m_pxContext = NULL;
   _this->m_xTaskHandle = NULL;
   _this->m_pfPMState2FuncMap = NULL;
   _this->m_pPMState2PMStateMap = NULL;
@@ -176,6 +229,21 @@ sys_error_code_t AMTInit(AManagedTask *_this) {
   _this->m_xStatus.nIsTaskStillRunning = 0;
   _this->m_xStatus.nErrorCount = 0;
   _this->m_xStatus.nReserved = 0;
+#if (AMT_CFG_ENABLE_STEP_PROFILER == 1)
+  _this->m_pxStepProfile = NULL;
+#endif
+  /* check that the bit masks match the layout of the bit fields.*/
+  assert_param(_this->m_xStatus.nRaw == AMT_STATUS_DELAY_PM_SWITCH_Msk);
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+  _this->m_xResumeSem = xSemaphoreCreateBinary();
+#else
+  _this->m_xResumeSem = xSemaphoreCreateBinaryStatic(&_this->m_xResumeSemBuffer);
+#endif
+  if (_this->m_xResumeSem == NULL) {
+    SYS_SET_SERVICE_LEVEL_ERROR_CODE(SYS_OUT_OF_MEMORY_ERROR_CODE);
+    return SYS_OUT_OF_MEMORY_ERROR_CODE;
+  }
 
   return SYS_NO_ERROR_CODE;
 }
@@ -198,13 +266,21 @@ EPowerMode AMTGetTaskPowerMode(AManagedTask *_this) {
 
 SYS_DEFINE_INLINE
 sys_error_code_t AMTNotifyIsStillRunning(AManagedTask *_this, sys_error_code_t nStepError) {
-
-  if (SYS_IS_ERROR_CODE(nStepError) && (_this->m_xStatus.nErrorCount < MT_MAX_ERROR_COUNT)) {
-    _this->m_xStatus.nErrorCount++;
-  }
-  if (_this->m_xStatus.nErrorCount < MT_ALLOWED_ERROR_COUNT) {
-    _this->m_xStatus.nIsTaskStillRunning = 1;
-  }
+  uint8_t nStatus;
+  uint8_t nNewStatus;
+  uint8_t nErrorCount;
+
+  do {
+    nStatus = _this->m_xStatus.nRaw;
+    nErrorCount = (nStatus & AMT_STATUS_ERROR_COUNT_Msk) >> AMT_STATUS_ERROR_COUNT_Pos;
+    if (SYS_IS_ERROR_CODE(nStepError) && (nErrorCount < MT_MAX_ERROR_COUNT)) {
+      nErrorCount++;
+    }
+    nNewStatus = (nStatus & ~AMT_STATUS_ERROR_COUNT_Msk) | (uint8_t)(nErrorCount << AMT_STATUS_ERROR_COUNT_Pos);
+    if (nErrorCount < MT_ALLOWED_ERROR_COUNT) {
+      nNewStatus |= AMT_STATUS_IS_STILL_RUNNING_Msk;
+    }
+  } while (!AMTStatusCompareAndSwap(_this, nStatus, nNewStatus));
 
   return SYS_NO_ERROR_CODE;
 }
@@ -223,12 +299,30 @@ boolean_t AMTIsPowerModeSwitchPending(AManagedTask *_this) {
 }
 
 SYS_DEFINE_INLINE
-void AMTReportErrOnStepExecution(AManagedTask *_this, sys_error_code_t nStepError) {
-  UNUSED(nStepError);
+boolean_t AMTIsPowerModeSwitchRequired(AManagedTask *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode) {
+  assert_param(_this != NULL);
+  boolean_t bRes = (eActivePowerMode != eNewPowerMode) ? TRUE : FALSE;
 
-  if (_this->m_xStatus.nErrorCount < MT_ALLOWED_ERROR_COUNT) {
-    _this->m_xStatus.nErrorCount++;
+  if (_this->m_pPMState2PMStateMap != NULL) {
+    bRes = (_this->m_pPMState2PMStateMap[(uint8_t)eActivePowerMode] != _this->m_pPMState2PMStateMap[(uint8_t)eNewPowerMode]) ? TRUE : FALSE;
   }
+
+  return bRes;
+}
+
+SYS_DEFINE_INLINE
+void AMTReportErrOnStepExecution(AManagedTask *_this, sys_error_code_t nStepError) {
+  UNUSED(nStepError);
+  uint8_t nStatus;
+  uint8_t nErrorCount;
+
+  do {
+    nStatus = _this->m_xStatus.nRaw;
+    nErrorCount = (nStatus & AMT_STATUS_ERROR_COUNT_Msk) >> AMT_STATUS_ERROR_COUNT_Pos;
+    if (nErrorCount >= MT_ALLOWED_ERROR_COUNT) {
+      break;
+    }
+  } while (!AMTStatusCompareAndSwap(_this, nStatus, nStatus + (1U << AMT_STATUS_ERROR_COUNT_Pos)));
 }
 
 SYS_DEFINE_INLINE
@@ -240,6 +334,42 @@ sys_error_code_t AMTSetPMStateRemapFunc(AManagedTask *_this, EPowerMode *pPMStat
 	return SYS_NO_ERROR_CODE;
 }
 
+SYS_DEFINE_INLINE
+void AMTResume(AManagedTask *_this) {
+  assert_param(_this != NULL);
+
+  (void)xSemaphoreGive(_this->m_xResumeSem);
+}
+
+SYS_DEFINE_INLINE
+uint8_t AMTStatusModify(AManagedTask *_this, uint8_t nClearMask, uint8_t nSetMask) {
+  assert_param(_this != NULL);
+  uint8_t nStatus;
+
+  do {
+    nStatus = _this->m_xStatus.nRaw;
+  } while (!AMTStatusCompareAndSwap(_this, nStatus, (nStatus & ~nClearMask) | nSetMask));
+
+  return nStatus;
+}
+
+SYS_DEFINE_INLINE
+boolean_t AMTStatusTryDelayPowerModeSwitch(AManagedTask *_this) {
+  assert_param(_this != NULL);
+  boolean_t bRes = TRUE;
+  uint8_t nStatus;
+
+  do {
+    nStatus = _this->m_xStatus.nRaw;
+    if ((nStatus & AMT_STATUS_PM_SWITCH_PENDING_Msk) != 0U) {
+      bRes = FALSE;
+      break;
+    }
+  } while (!AMTStatusCompareAndSwap(_this, nStatus, nStatus | AMT_STATUS_DELAY_PM_SWITCH_Msk));
+
+  return bRes;
+}
+
 #ifdef __cplusplus
 }
 #endif
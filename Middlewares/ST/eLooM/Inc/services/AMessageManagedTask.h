@@ -0,0 +1,220 @@
+/**
+ ******************************************************************************
+ * @file    AMessageManagedTask.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Message driven managed task.
+ *
+ * An ::AMessageManagedTask is an ::AManagedTaskEx that owns an inbox of fixed size messages.
+ * Other tasks and ISRs post the messages with AMMTPost() and AMMTPostFromISR(), and the task
+ * processes them in batch: each step waits for the inbox without timeout, then it drains up to
+ * a maximum number of messages, and it calls the ProcessMessage() virtual function for each of them.
+ * A pending power mode switch stops the batch and wakes up the task, so the task does not delay
+ * the PM transaction.
+ *
+ * A concrete class puts AMMTProcessInbox() in its (PM_STATE, ExecuteStepFunc) map for the power modes
+ * where it processes the messages, and it uses AMMT_vtblForceExecuteStep() as ForceExecuteStep()
+ * virtual function, or call it from its own implementation.
+ * The task waits for the inbox with its FreeRTOS notification value, so a concrete class must not use it.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_AMESSAGEMANAGEDTASK_H_
+#define INCLUDE_SERVICES_AMESSAGEMANAGEDTASK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "AManagedTaskEx.h"
+#include "queue.h"
+
+
+#ifndef AMMT_CFG_MAX_MESSAGE_SIZE
+/**
+ * Specifies the maximum size in byte of a message. It can be redefined in the sysconfig.h file.
+ */
+#define AMMT_CFG_MAX_MESSAGE_SIZE             16U
+#endif
+
+/**
+ * Specifies the size in byte of an item of the inbox: the post time followed by the message.
+ */
+#define AMMT_INBOX_ITEM_SIZE(nMessageSize)    (sizeof(TickType_t) + (nMessageSize))
+
+/**
+ * Specifies the size in byte of the storage of an inbox. It is used to define the storage given to AMMTInitStatic().
+ */
+#define AMMT_INBOX_STORAGE_SIZE(nMessageSize, nInboxLength)  ((nInboxLength) * AMMT_INBOX_ITEM_SIZE(nMessageSize))
+
+
+/**
+ * Create  type name for _AMessageManagedTask.
+ */
+typedef struct _AMessageManagedTask AMessageManagedTask;
+
+/**
+ * Inbox statistics of a message managed task. The latency is the time, in tick, between the post of
+ * a message and the start of its processing.
+ */
+typedef struct _AMMTStats {
+  /**
+   * Specifies the number of messages posted in the inbox.
+   */
+  uint32_t nPostedCount;
+
+  /**
+   * Specifies the number of messages lost because the inbox was full.
+   */
+  uint32_t nDroppedCount;
+
+  /**
+   * Specifies the number of processed messages.
+   */
+  uint32_t nProcessedCount;
+
+  /**
+   * Specifies the number of processed batches. The mean batch size is nProcessedCount / nBatchCount.
+   */
+  uint32_t nBatchCount;
+
+  /**
+   * Specifies the maximum number of messages found in the inbox at the start of a batch.
+   */
+  UBaseType_t nMaxDepth;
+
+  /**
+   * Specifies the sum of the latency, used to compute the mean latency.
+   */
+  uint32_t nLatencySum;
+
+  /**
+   * Specifies the maximum latency.
+   */
+  TickType_t xMaxLatency;
+} AMMTStats;
+
+
+// Public API declaration
+//***********************
+
+/**
+ * Initialize a message managed task structure and allocate its inbox. The application is responsible to allocate
+ * a managed task in memory. This method must be called after the allocation.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @param nMessageSize [IN] specifies the size in byte of a message. It must be less or equal to ::AMMT_CFG_MAX_MESSAGE_SIZE.
+ * @param nInboxLength [IN] specifies the maximum number of messages in the inbox.
+ * @param nMaxBatchSize [IN] specifies the maximum number of messages processed in a step.
+ * @return \a SYS_NO_ERROR_CODE if success, SYS_OUT_OF_MEMORY_ERROR_CODE if the inbox cannot be allocated.
+ */
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+sys_error_code_t AMMTInit(AMessageManagedTask *_this, size_t nMessageSize, UBaseType_t nInboxLength, uint8_t nMaxBatchSize);
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ * Initialize a message managed task structure, like AMMTInit(), but the inbox is created in the memory provided
+ * by the application. It is the only way to initialize the task in static allocation mode
+ * (`configSUPPORT_DYNAMIC_ALLOCATION = 0`).
+ *
+ * ~~~{.c}
+ * static uint8_t s_pnInboxStorage[AMMT_INBOX_STORAGE_SIZE(sizeof(MyMessage), 8U)];
+ * static StaticQueue_t s_xInboxBuffer;
+ *
+ * xRes = AMMTInitStatic(&pObj->super, sizeof(MyMessage), 8U, 4U, s_pnInboxStorage, &s_xInboxBuffer);
+ * ~~~
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @param nMessageSize [IN] specifies the size in byte of a message. It must be less or equal to ::AMMT_CFG_MAX_MESSAGE_SIZE.
+ * @param nInboxLength [IN] specifies the maximum number of messages in the inbox.
+ * @param nMaxBatchSize [IN] specifies the maximum number of messages processed in a step.
+ * @param pnInboxStorage [IN] specifies the storage of the inbox. Its size is given by ::AMMT_INBOX_STORAGE_SIZE.
+ * @param pxInboxBuffer [IN] specifies the queue control block of the inbox.
+ * @return \a SYS_NO_ERROR_CODE if success, SYS_INVALID_PARAMETER_ERROR_CODE if the memory of the inbox is not valid.
+ */
+sys_error_code_t AMMTInitStatic(AMessageManagedTask *_this, size_t nMessageSize, UBaseType_t nInboxLength, uint8_t nMaxBatchSize,
+    uint8_t *pnInboxStorage, StaticQueue_t *pxInboxBuffer);
+#endif
+
+/**
+ * Post a message in the inbox of the task. The message is copied.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @param pvMessage [IN] specifies the message.
+ * @param xTimeout [IN] specifies the time, in tick, to wait for a free slot in the inbox.
+ * @return \a SYS_NO_ERROR_CODE if success, SYS_TASK_QUEUE_FULL_ERROR_CODE if the inbox is full.
+ */
+sys_error_code_t AMMTPost(AMessageManagedTask *_this, const void *pvMessage, TickType_t xTimeout);
+
+/**
+ * Post a message in the inbox of the task. This function can be called only from an ISR.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @param pvMessage [IN] specifies the message.
+ * @param pxHigherPriorityTaskWoken [OUT] set to `pdTRUE` if the post unblocked a task with a higher priority
+ *        than the running one.
+ * @return \a SYS_NO_ERROR_CODE if success, SYS_TASK_QUEUE_FULL_ERROR_CODE if the inbox is full.
+ */
+sys_error_code_t AMMTPostFromISR(AMessageManagedTask *_this, const void *pvMessage, BaseType_t *pxHigherPriorityTaskWoken);
+
+/**
+ * Step function of a message managed task. It waits for the inbox and it processes up to the maximum
+ * batch size of messages. If a power mode switch is pending it returns without waiting.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @return \a SYS_NO_ERROR_CODE if success, the error of the last message processing that failed otherwise.
+ */
+sys_error_code_t AMMTProcessInbox(AManagedTask *_this);
+
+/**
+ * Get the number of messages in the inbox.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @return the number of messages in the inbox.
+ */
+inline UBaseType_t AMMTGetInboxDepth(AMessageManagedTask *_this);
+
+/**
+ * Get the inbox statistics of the task.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @return a copy of the inbox statistics.
+ */
+inline AMMTStats AMMTGetStats(AMessageManagedTask *_this);
+
+/**
+ * Reset the inbox statistics of the task.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @return \a SYS_NO_ERROR_CODE
+ */
+inline sys_error_code_t AMMTResetStats(AMessageManagedTask *_this);
+
+/**
+ * Process a message of the inbox.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @param pvMessage [IN] specifies the message. It is valid only during the call.
+ * @return \a SYS_NO_ERROR_CODE if success, an application specific error code otherwise.
+ */
+inline sys_error_code_t AMMTProcessMessage(AMessageManagedTask *_this, void *pvMessage);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_AMESSAGEMANAGEDTASK_H_ */
@@ -0,0 +1,147 @@
+/**
+ ******************************************************************************
+ * @file    AMessageManagedTask_vtbl.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief
+ *
+ * TODO - insert here the file description
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_AMESSAGEMANAGEDTASK_VTBL_H_
+#define INCLUDE_SERVICES_AMESSAGEMANAGEDTASK_VTBL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "AMessageManagedTask.h"
+#include "AManagedTaskEx_vtbl.h"
+
+
+/**
+ * Create  type name for _AMessageManagedTask_vtbl.
+ */
+typedef struct _AMessageManagedTask_vtbl AMessageManagedTask_vtbl;
+
+/**
+ * The virtual table of a message managed task. The first part is the ::AManagedTaskEx_vtbl.
+ */
+struct _AMessageManagedTask_vtbl {
+  sys_error_code_t (*HardwareInit)(AManagedTask *_this, void *pParams);
+  sys_error_code_t (*OnCreateTask)(AManagedTask *_this, TaskFunction_t *pvTaskCode, const char **pcName, unsigned short *pnStackDepth, void **pParams, UBaseType_t *pxPriority);
+  sys_error_code_t (*DoEnterPowerMode)(AManagedTask *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
+  sys_error_code_t (*HandleError)(AManagedTask *_this, SysEvent xError);
+  sys_error_code_t (*OnEnterTaskControlLoop)(AManagedTask *_this);
+  sys_error_code_t (*ForceExecuteStep)(AManagedTaskEx *_this, EPowerMode eActivePowerMode);
+  sys_error_code_t (*OnEnterPowerMode)(AManagedTaskEx *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
+  sys_error_code_t (*ProcessMessage)(AMessageManagedTask *_this, void *pvMessage);
+};
+
+/**
+ * A message managed task. It extends the ::AManagedTaskEx with an inbox and its statistics.
+ * The `super.vptr` member points to an ::AMessageManagedTask_vtbl.
+ */
+struct _AMessageManagedTask {
+  /**
+   * Base class object.
+   */
+  AManagedTaskEx super;
+
+  /**
+   * Specifies the inbox. Each item is an ::AMMTEnvelope header followed by the message.
+   */
+  QueueHandle_t m_xInbox;
+
+  /**
+   * Specifies the size in byte of a message.
+   */
+  uint16_t m_nMessageSize;
+
+  /**
+   * Specifies the maximum number of messages processed in a step.
+   */
+  uint8_t m_nMaxBatchSize;
+
+  /**
+   * Inbox statistics.
+   */
+  AMMTStats m_xStats;
+};
+
+
+// AManagedTaskEx virtual functions
+
+/**
+ * Default implementation of the ForceExecuteStep() virtual function. It wakes up the task if it is waiting
+ * for the inbox, so the task can see the pending power mode switch.
+ * @sa AMTExForceExecuteStep
+ */
+sys_error_code_t AMMT_vtblForceExecuteStep(AManagedTaskEx *_this, EPowerMode eActivePowerMode);
+
+
+// Inline functions definition
+// ***************************
+
+SYS_DEFINE_INLINE
+UBaseType_t AMMTGetInboxDepth(AMessageManagedTask *_this) {
+  assert_param(_this != NULL);
+
+  return uxQueueMessagesWaiting(_this->m_xInbox);
+}
+
+SYS_DEFINE_INLINE
+AMMTStats AMMTGetStats(AMessageManagedTask *_this) {
+  assert_param(_this != NULL);
+  AMMTStats xStats;
+
+  taskENTER_CRITICAL();
+  xStats = _this->m_xStats;
+  taskEXIT_CRITICAL();
+
+  return xStats;
+}
+
+SYS_DEFINE_INLINE
+sys_error_code_t AMMTResetStats(AMessageManagedTask *_this) {
+  assert_param(_this != NULL);
+
+  taskENTER_CRITICAL();
+  _this->m_xStats.nPostedCount = 0;
+  _this->m_xStats.nDroppedCount = 0;
+  _this->m_xStats.nProcessedCount = 0;
+  _this->m_xStats.nBatchCount = 0;
+  _this->m_xStats.nMaxDepth = 0;
+  _this->m_xStats.nLatencySum = 0;
+  _this->m_xStats.xMaxLatency = 0;
+  taskEXIT_CRITICAL();
+
+  return SYS_NO_ERROR_CODE;
+}
+
+SYS_DEFINE_INLINE
+sys_error_code_t AMMTProcessMessage(AMessageManagedTask *_this, void *pvMessage) {
+  assert_param(_this != NULL);
+
+  return ((const AMessageManagedTask_vtbl*)_this->super.vptr)->ProcessMessage(_this, pvMessage);
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* INCLUDE_SERVICES_AMESSAGEMANAGEDTASK_VTBL_H_ */
@@ -0,0 +1,144 @@
+/**
+ ******************************************************************************
+ * @file    APeriodicManagedTask.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Periodic managed task.
+ *
+ * An ::APeriodicManagedTask is an ::AManagedTaskEx that executes its step with a period
+ * that depends on the power mode. The step is released at absolute times (see `vTaskDelayUntil()`),
+ * so the execution time of the step does not add a drift to the period.
+ * The task records the release jitter and the overruns, and it recovers from an overrun according to
+ * the ::EAPMTOverrunPolicy.
+ *
+ * A concrete class uses APMTRun() as task control loop, and APMT_vtblForceExecuteStep() as
+ * ForceExecuteStep() virtual function, or call it from its own implementation.
+ * It requires `INCLUDE_vTaskDelayUntil` and `INCLUDE_xTaskAbortDelay` in the FreeRTOSConfig.h file.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_APERIODICMANAGEDTASK_H_
+#define INCLUDE_SERVICES_APERIODICMANAGEDTASK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "AManagedTaskEx.h"
+
+
+/**
+ * Create  type name for _APeriodicManagedTask.
+ */
+typedef struct _APeriodicManagedTask APeriodicManagedTask;
+
+/**
+ * Specifies how a periodic task recovers when a step ends after the next release time.
+ */
+typedef enum _EAPMTOverrunPolicy {
+  E_APMT_OVERRUN_CATCH_UP = 0, /**< the missed releases are executed back to back, until the task is again on time. */
+  E_APMT_OVERRUN_SKIP = 1      /**< the missed releases are skipped, and the task waits for the next release time. */
+} EAPMTOverrunPolicy;
+
+/**
+ * Timing statistics of a periodic task. The times are in tick.
+ */
+typedef struct _APMTStats {
+  /**
+   * Specifies the number of executed steps.
+   */
+  uint32_t nReleaseCount;
+
+  /**
+   * Specifies the number of steps that ended after the next release time.
+   */
+  uint32_t nOverrunCount;
+
+  /**
+   * Specifies the number of releases skipped with the ::E_APMT_OVERRUN_SKIP policy.
+   */
+  uint32_t nSkippedCount;
+
+  /**
+   * Specifies the sum of the jitter, used to compute the mean jitter.
+   * The jitter is the difference between the time a step starts and its release time.
+   */
+  uint32_t nJitterSum;
+
+  /**
+   * Specifies the maximum jitter.
+   */
+  TickType_t xMaxJitter;
+} APMTStats;
+
+
+// Public API declaration
+//***********************
+
+/**
+ * Initialize a periodic managed task structure. The application is responsible to allocate
+ * a managed task in memory. This method must be called after the allocation.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @param pnPMState2PeriodMap [IN] specifies a map (PM_STATE, period in ms). The map must be implemented with an array,
+ *        and the number of elements of the array must be equal to the number of states of the PM state machine.
+ *        A period equal to zero means that the steps are executed back to back, as in AMTExRun().
+ * @param eOverrunPolicy [IN] specifies how the task recovers from an overrun.
+ * @return \a SYS_NO_ERROR_CODE
+ */
+inline sys_error_code_t APMTInit(APeriodicManagedTask *_this, const uint32_t *pnPMState2PeriodMap, EAPMTOverrunPolicy eOverrunPolicy);
+
+/**
+ * Get the period of the task in a given power mode.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @param ePowerMode [IN] specifies a power mode of the task (that is after the remap).
+ * @return the period in tick, or zero if the task is not periodic in that power mode.
+ */
+inline TickType_t APMTGetPeriod(APeriodicManagedTask *_this, EPowerMode ePowerMode);
+
+/**
+ * Get the timing statistics of the task.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @return a copy of the timing statistics.
+ */
+inline APMTStats APMTGetStats(APeriodicManagedTask *_this);
+
+/**
+ * Reset the timing statistics of the task.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @return \a SYS_NO_ERROR_CODE
+ */
+inline sys_error_code_t APMTResetStats(APeriodicManagedTask *_this);
+
+/**
+ * This is the control loop of a periodic managed task. The task waits for the release time of the step
+ * without delaying a power mode switch: INIT interrupts the wait through AMTExForceExecuteStep().
+ * After a power mode switch the first step is executed immediately, and the next ones with the
+ * period of the new power mode.
+ *
+ * @param pParams [IN] specify a pointer to the task object:
+ * APeriodicManagedTask *pTask = (APeriodicManagedTask*)pParams;
+ */
+void APMTRun(void *pParams);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_APERIODICMANAGEDTASK_H_ */
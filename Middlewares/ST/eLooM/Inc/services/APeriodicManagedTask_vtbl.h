@@ -0,0 +1,147 @@
+/**
+ ******************************************************************************
+ * @file    APeriodicManagedTask_vtbl.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief
+ *
+ * TODO - insert here the file description
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_APERIODICMANAGEDTASK_VTBL_H_
+#define INCLUDE_SERVICES_APERIODICMANAGEDTASK_VTBL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "APeriodicManagedTask.h"
+#include "AManagedTaskEx_vtbl.h"
+
+
+/**
+ * A periodic managed task. It extends the ::AManagedTaskEx with the period of each power mode and the
+ * timing statistics.
+ */
+struct _APeriodicManagedTask {
+  /**
+   * Base class object.
+   */
+  AManagedTaskEx super;
+
+  /**
+   * Specifies a map (PM_STATE, period in ms) between each application PM state and the period of the step.
+   */
+  const uint32_t *m_pnPMState2PeriodMap;
+
+  /**
+   * Specifies the release time of the last step.
+   */
+  TickType_t m_xLastReleaseTime;
+
+  /**
+   * Specifies the overrun policy. The actual type is ::EAPMTOverrunPolicy.
+   */
+  uint8_t m_eOverrunPolicy;
+
+  /**
+   * `TRUE` if the release times must be aligned to the current time, for example after a power mode switch.
+   */
+  boolean_t m_bResync;
+
+  /**
+   * `TRUE` when the task waits for the release time. It is used to interrupt only the wait,
+   * and not a blocking call of the step. The task sets it only if there is no power mode switch pending,
+   * in a critical section (see APMTWaitForRelease()).
+   */
+  volatile boolean_t m_bIsWaitingRelease;
+
+  /**
+   * Timing statistics.
+   */
+  APMTStats m_xStats;
+};
+
+
+// AManagedTaskEx virtual functions
+
+/**
+ * Default implementation of the ForceExecuteStep() virtual function. If the task is waiting for the release time
+ * it interrupts the wait, so the task can see the pending power mode switch.
+ * @sa AMTExForceExecuteStep
+ */
+sys_error_code_t APMT_vtblForceExecuteStep(AManagedTaskEx *_this, EPowerMode eActivePowerMode);
+
+
+// Inline functions definition
+// ***************************
+
+SYS_DEFINE_INLINE
+sys_error_code_t APMTInit(APeriodicManagedTask *_this, const uint32_t *pnPMState2PeriodMap, EAPMTOverrunPolicy eOverrunPolicy) {
+  assert_param(_this != NULL);
+  assert_param(pnPMState2PeriodMap != NULL);
+
+  (void)AMTInitEx(&_this->super);
+  _this->m_pnPMState2PeriodMap = pnPMState2PeriodMap;
+  _this->m_xLastReleaseTime = 0;
+  _this->m_eOverrunPolicy = (uint8_t)eOverrunPolicy;
+  _this->m_bResync = TRUE;
+  _this->m_bIsWaitingRelease = FALSE;
+  (void)APMTResetStats(_this);
+
+  return SYS_NO_ERROR_CODE;
+}
+
+SYS_DEFINE_INLINE
+TickType_t APMTGetPeriod(APeriodicManagedTask *_this, EPowerMode ePowerMode) {
+  assert_param(_this != NULL);
+
+  return pdMS_TO_TICKS(_this->m_pnPMState2PeriodMap[(uint8_t)ePowerMode]);
+}
+
+SYS_DEFINE_INLINE
+APMTStats APMTGetStats(APeriodicManagedTask *_this) {
+  assert_param(_this != NULL);
+  APMTStats xStats;
+
+  taskENTER_CRITICAL();
+  xStats = _this->m_xStats;
+  taskEXIT_CRITICAL();
+
+  return xStats;
+}
+
+SYS_DEFINE_INLINE
+sys_error_code_t APMTResetStats(APeriodicManagedTask *_this) {
+  assert_param(_this != NULL);
+
+  taskENTER_CRITICAL();
+  _this->m_xStats.nReleaseCount = 0;
+  _this->m_xStats.nOverrunCount = 0;
+  _this->m_xStats.nSkippedCount = 0;
+  _this->m_xStats.nJitterSum = 0;
+  _this->m_xStats.xMaxJitter = 0;
+  taskEXIT_CRITICAL();
+
+  return SYS_NO_ERROR_CODE;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* INCLUDE_SERVICES_APERIODICMANAGEDTASK_VTBL_H_ */
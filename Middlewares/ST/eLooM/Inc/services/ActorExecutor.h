@@ -0,0 +1,132 @@
+/**
+ ******************************************************************************
+ * @file    ActorExecutor.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Managed task that hosts many ::AManagedActor.
+ *
+ * The executor is an ::AManagedTaskEx, so INIT sees only one task with one stack. The executor
+ * executes the steps of the ready actors one after the other, and it blocks when no actor is ready.
+ * It forwards to the actors:
+ * - the hardware initialization and the one time initialization of the control loop.
+ * - the power mode transactions. The actors do the transaction when the executor does it.
+ * - the error events.
+ *
+ * An actor step that returns an error is reported as an error of the executor step, so the actors
+ * take part in the error watchdog of the managed tasks.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_ACTOREXECUTOR_H_
+#define INCLUDE_SERVICES_ACTOREXECUTOR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "AManagedTaskEx.h"
+#include "AManagedTaskEx_vtbl.h"
+#include "AManagedActor.h"
+#include "AManagedActor_vtbl.h"
+
+
+#ifndef ACTOR_EXECUTOR_CFG_MAX_PM_STATES
+/**
+ * Specifies the maximum number of states of the application PM state machine. By default it is the number
+ * of states of ::EPowerMode, so the maps of the task cover all the PM states of the application.
+ */
+#define ACTOR_EXECUTOR_CFG_MAX_PM_STATES      ((uint8_t)E_POWER_MODE_NONE)
+#endif
+
+
+/**
+ * Create  type name for _ActorExecutor.
+ */
+typedef struct _ActorExecutor ActorExecutor;
+
+/**
+ * ActorExecutor internal structure.
+ */
+struct _ActorExecutor {
+  /**
+   * Base class object.
+   */
+  AManagedTaskEx super;
+
+  /**
+   * Specifies the first actor of the executor.
+   */
+  AManagedActor *m_pxActors;
+
+  /**
+   * Specifies the name of the executor task.
+   */
+  const char *m_pcName;
+
+  /**
+   * Specifies the stack depth, in word, of the executor task. It must fit the deepest actor step.
+   */
+  unsigned short m_nStackDepth;
+
+  /**
+   * Specifies the priority of the executor task.
+   */
+  UBaseType_t m_xPriority;
+};
+
+
+/* Public API declaration */
+/**************************/
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+/**
+ * Allocate an instance of ActorExecutor. It is allocated with SysAlloc().
+ *
+ * @param pcName [IN] specifies the name of the executor task.
+ * @param nStackDepth [IN] specifies the stack depth, in word, of the executor task.
+ * @param xPriority [IN] specifies the priority of the executor task.
+ * @return a pointer to the generic object ::AManagedTaskEx if success,
+ * or NULL if out of memory error occurs.
+ */
+AManagedTaskEx *ActorExecutorAlloc(const char *pcName, unsigned short nStackDepth, UBaseType_t xPriority);
+#endif
+
+/**
+ * Initialize an instance of ActorExecutor in a memory block provided by the application. It is the allocator
+ * used in static allocation mode (`configSUPPORT_DYNAMIC_ALLOCATION = 0`).
+ *
+ * @param pxMemBlock [IN] specifies the memory of the object. It must be a ::ActorExecutor.
+ * @param pcName [IN] specifies the name of the executor task.
+ * @param nStackDepth [IN] specifies the stack depth, in word, of the executor task.
+ * @param xPriority [IN] specifies the priority of the executor task.
+ * @return a pointer to the generic object ::AManagedTaskEx, or NULL if pxMemBlock is NULL or the object cannot be initialized (see AMTInitEx()).
+ */
+AManagedTaskEx *ActorExecutorStaticAlloc(ActorExecutor *pxMemBlock, const char *pcName, unsigned short nStackDepth, UBaseType_t xPriority);
+
+/**
+ * Add an actor to an executor. The actors must be added before the executor is added to the application context.
+ *
+ * @param _this [IN] specifies a pointer to the executor.
+ * @param pxActor [IN] specifies the actor to add. It must not belong to another executor.
+ * @return SYS_NO_ERROR_CODE if success, SYS_INVALID_PARAMETER_ERROR_CODE if the actor belongs to an executor.
+ */
+sys_error_code_t ActorExecutorAddActor(AManagedTaskEx *_this, AManagedActor *pxActor);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_ACTOREXECUTOR_H_ */
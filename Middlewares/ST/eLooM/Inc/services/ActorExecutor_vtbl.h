@@ -0,0 +1,47 @@
+/**
+ ******************************************************************************
+ * @file    ActorExecutor_vtbl.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief
+ *
+ * TODO - insert here the file description
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_ACTOREXECUTOR_VTBL_H_
+#define INCLUDE_SERVICES_ACTOREXECUTOR_VTBL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// AManagedTask virtual functions
+sys_error_code_t ActorExecutor_vtblHardwareInit(AManagedTask *_this, void *pParams); ///< @sa AMTHardwareInit
+sys_error_code_t ActorExecutor_vtblOnCreateTask(AManagedTask *_this, TaskFunction_t *pvTaskCode, const char **pcName, unsigned short *pnStackDepth, void **pParams, UBaseType_t *pxPriority); ///< @sa AMTOnCreateTask
+sys_error_code_t ActorExecutor_vtblDoEnterPowerMode(AManagedTask *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode); ///< @sa AMTDoEnterPowerMode
+sys_error_code_t ActorExecutor_vtblHandleError(AManagedTask *_this, SysEvent xError); ///< @sa AMTHandleError
+sys_error_code_t ActorExecutor_vtblOnEnterTaskControlLoop(AManagedTask *_this); ///< @sa AMTOnEnterTaskControlLoop
+
+// AManagedTaskEx virtual functions
+sys_error_code_t ActorExecutor_vtblForceExecuteStep(AManagedTaskEx *_this, EPowerMode eActivePowerMode); ///< @sa AMTExForceExecuteStep
+sys_error_code_t ActorExecutor_vtblOnEnterPowerMode(AManagedTaskEx *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode); ///< @sa AMTExOnEnterPowerMode
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_ACTOREXECUTOR_VTBL_H_ */
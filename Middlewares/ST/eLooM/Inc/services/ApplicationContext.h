@@ -36,6 +36,8 @@ extern "C" {
 
 /**
  * An application context is a linked list of Managed tasks.
+ * The tasks are also partitioned in one bucket per power mode class (see ::EPMClass), so that the INIT task
+ * can process a power mode transaction only for the tasks belonging to a PM class.
  */
 typedef struct _ApplicationContext {
 	/**
@@ -47,6 +49,16 @@ typedef struct _ApplicationContext {
 	 * Specifies the number of item (Managed Task object) in the list.
 	 */
 	uint8_t m_nListSize;
+
+	/**
+	 * Specifies the pointer to the first task of each PM class bucket.
+	 */
+	AManagedTask *m_pPMClassHead[AMT_PM_CLASS_COUNT];
+
+	/**
+	 * Specifies the number of item (Managed Task object) in each PM class bucket.
+	 */
+	uint8_t m_nPMClassSize[AMT_PM_CLASS_COUNT];
 }ApplicationContext;
 
 // Public API declaration
@@ -71,14 +83,39 @@ sys_error_code_t ACInit(ApplicationContext *_this);
 sys_error_code_t ACAddTask(ApplicationContext *_this, AManagedTask *pTask);
 
 /**
- * Remove a managed task from this context.
+ * Add a managed task at the head of this context without checking if the task is already in this context.
+ * It is used by INIT to load the application manifest (see sysmanifest.h), that lists each task once.
+ *
+ * @param _this specifies a pointer to the application context object.
+ * @param pTask specifies a pointer to a managed task object that is not in this context.
+ * @return SYS_NO_ERROR_CODE if success, SYS_INVALID_PARAMETER_ERROR_CODE if the PM class of the task is not valid.
+ */
+sys_error_code_t ACPushTask(ApplicationContext *_this, AManagedTask *pTask);
+
+/**
+ * Remove a managed task from this context. The function removes only the task object from the list
+ * and from the bucket of its PM class: the native task and the resources of the task are not released.
+ * To remove a running task use SysUnloadTask().
  *
  * @param _this specifies a pointer to the application context object.
  * @param pTask specifies a pointer to a managed task object to be removed from this context.
- * @return SYS_NO_ERROR_CODE.
+ * @return SYS_NO_ERROR_CODE if the task has been removed from the application context, or SYS_AC_TASK_NOT_FOUND_ERROR_CODE
+ *         if the task is not in this application context.
  */
 sys_error_code_t ACRemoveTask(ApplicationContext *_this, AManagedTask *pTask);
 
+/**
+ * Move a task in the bucket of a new PM class, and then set the PM class of the task. It is called by INIT
+ * (see SysSetTaskPMClass()), that does not walk the buckets at the same time.
+ *
+ * @param _this specifies a pointer to the application context object.
+ * @param pTask specifies a pointer to a managed task object in this context.
+ * @param eNewPMClass specifies the new PM class of the task.
+ * @return SYS_NO_ERROR_CODE if success, SYS_INVALID_PARAMETER_ERROR_CODE if the PM class is not valid or the task
+ *         is not in this context. In case of error the PM class of the task is not changed.
+ */
+sys_error_code_t ACSetTaskPMClass(ApplicationContext *_this, AManagedTask *pTask, EPMClass eNewPMClass);
+
 /**
  * Get the number of managed task in this context.
  *
@@ -104,6 +141,33 @@ inline AManagedTask *ACGetFirstTask(ApplicationContext *_this);
  */
 inline AManagedTask *ACGetNextTask(ApplicationContext *_this, const AManagedTask *pTask);
 
+/**
+ * Get the number of managed task belonging to a PM class in this context.
+ *
+ * @param _this specifies a pointer to the application context object.
+ * @param ePMClass specifies a PM class.
+ * @return the number of managed task belonging to ePMClass.
+ */
+inline uint8_t ACGetTaskCountInPMClass(ApplicationContext *_this, EPMClass ePMClass);
+
+/**
+ * Get a pointer to the first task object belonging to a PM class in this application context.
+ *
+ * @param _this specifies a pointer to the application context object.
+ * @param ePMClass specifies a PM class.
+ * @return a pointer to the first task object belonging to ePMClass, or NULL if there are no task in the PM class.
+ */
+inline AManagedTask *ACGetFirstTaskInPMClass(ApplicationContext *_this, EPMClass ePMClass);
+
+/**
+ * Get a pointer to the next task object after pTask with the same PM class in this application context.
+ *
+ * @param _this specifies a pointer to the application context object.
+ * @param pTasks specifies a pointer a managed task object in this context.
+ * @return a pointer to the next task object after pTask with the same PM class in this application context.
+ */
+inline AManagedTask *ACGetNextTaskInPMClass(ApplicationContext *_this, const AManagedTask *pTask);
+
 
 // Inline functions definition
 // ***************************
@@ -131,6 +195,31 @@ AManagedTask *ACGetNextTask(ApplicationContext *_this, const AManagedTask *pTask
 	return pTask->m_pNext;
 }
 
+SYS_DEFINE_INLINE
+uint8_t ACGetTaskCountInPMClass(ApplicationContext *_this, EPMClass ePMClass) {
+	assert_param(_this != NULL);
+	assert_param((uint8_t)ePMClass < AMT_PM_CLASS_COUNT);
+
+	return _this->m_nPMClassSize[(uint8_t)ePMClass];
+}
+
+SYS_DEFINE_INLINE
+AManagedTask *ACGetFirstTaskInPMClass(ApplicationContext *_this, EPMClass ePMClass) {
+	assert_param(_this != NULL);
+	assert_param((uint8_t)ePMClass < AMT_PM_CLASS_COUNT);
+
+	return _this->m_pPMClassHead[(uint8_t)ePMClass];
+}
+
+SYS_DEFINE_INLINE
+AManagedTask *ACGetNextTaskInPMClass(ApplicationContext *_this, const AManagedTask *pTask) {
+	assert_param(_this != NULL);
+	assert_param(pTask != NULL);
+	UNUSED(_this);
+
+	return pTask->m_pNextInPMClass;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,171 @@
+/**
+ ******************************************************************************
+ * @file    DeferredWorkQueue.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Deferred work queue service.
+ *
+ * The deferred work queue is a system managed task that executes the work items submitted by the ISRs
+ * (the bottom half of an interrupt), so a driver does not need its own helper task.
+ * The work items are submitted with DWQSubmitFromISR() in a lock-free ring, and the task executes them in batch
+ * each time it is woken up. A pending power mode switch stops the batch, and the remaining work items
+ * are executed in the new power mode.
+ *
+ * There is only one deferred work queue. The application adds it to the ::ApplicationContext in the
+ * SysLoadApplicationContext() function:
+ *
+ * ~~~{.c}
+ * xRes = ACAddTask(pAppContext, (AManagedTask*)DWQAlloc());
+ * ~~~
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_DEFERREDWORKQUEUE_H_
+#define INCLUDE_SERVICES_DEFERREDWORKQUEUE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "AManagedTaskEx.h"
+
+
+#ifndef DWQ_TASK_CFG_STACK_DEPTH
+/**
+ * Specifies the stack depth, in word, of the deferred work queue task. It is public to allow the application
+ * to allocate the stack in the manifest (see sysmanifest.h).
+ */
+#define DWQ_TASK_CFG_STACK_DEPTH              (configMINIMAL_STACK_SIZE*3)
+#endif
+
+#ifndef DWQ_TASK_CFG_PRIORITY
+#define DWQ_TASK_CFG_PRIORITY                 (configMAX_PRIORITIES - 2)
+#endif
+
+#ifndef DWQ_CFG_RING_SIZE
+/**
+ * Specifies the number of work items in the submission ring. It must be a power of two.
+ */
+#define DWQ_CFG_RING_SIZE                     16U
+#endif
+
+#if ((DWQ_CFG_RING_SIZE & (DWQ_CFG_RING_SIZE - 1U)) != 0U) || (DWQ_CFG_RING_SIZE < 2U)
+#error DWQ_CFG_RING_SIZE must be a power of two
+#endif
+
+#ifndef DWQ_CFG_MAX_BATCH_SIZE
+/**
+ * Specifies the maximum number of work items executed in a step.
+ */
+#define DWQ_CFG_MAX_BATCH_SIZE                8U
+#endif
+
+#ifndef DWQ_CFG_MAX_PM_STATES
+/**
+ * Specifies the maximum number of states of the application PM state machine. By default it is the number
+ * of states of ::EPowerMode, so the maps of the task cover all the PM states of the application.
+ */
+#define DWQ_CFG_MAX_PM_STATES                 ((uint8_t)E_POWER_MODE_NONE)
+#endif
+
+
+/**
+ * Create  type name for _DeferredWorkQueue.
+ */
+typedef struct _DeferredWorkQueue DeferredWorkQueue;
+
+/**
+ * Specifies the prototype of a work item function. It is executed by the deferred work queue task.
+ *
+ * @param pvArg [IN] specifies the argument given to DWQSubmitFromISR().
+ * @param nParam [IN] specifies the parameter given to DWQSubmitFromISR().
+ * @return \a SYS_NO_ERROR_CODE if success, an application specific error code otherwise.
+ */
+typedef sys_error_code_t (*pDWQWorkFunc_t)(void *pvArg, uint32_t nParam);
+
+/**
+ * Statistics of the deferred work queue.
+ */
+typedef struct _DWQStats {
+  /**
+   * Specifies the number of executed work items.
+   */
+  uint32_t nExecutedCount;
+
+  /**
+   * Specifies the number of work items lost because the ring was full.
+   */
+  uint32_t nDroppedCount;
+
+  /**
+   * Specifies the number of batches. The mean batch size is nExecutedCount / nBatchCount.
+   */
+  uint32_t nBatchCount;
+
+  /**
+   * Specifies the maximum number of pending work items found at the start of a batch.
+   */
+  uint32_t nMaxDepth;
+} DWQStats;
+
+
+// Public API declaration
+//***********************
+
+/**
+ * Allocate the deferred work queue. It is a singleton, so the function always returns the same object.
+ * The task priority and stack are defined by DWQ_TASK_CFG_PRIORITY and DWQ_TASK_CFG_STACK_DEPTH.
+ *
+ * @return a pointer to the deferred work queue task, or NULL if the object cannot be initialized (see AMTInitEx()).
+ */
+AManagedTaskEx *DWQAlloc(void);
+
+/**
+ * Submit a work item from an ISR. The work item is executed later by the deferred work queue task.
+ * It is lock-free, so it can be called also from nested ISRs, and it does not disable the interrupts.
+ *
+ * @param pfWork [IN] specifies the work item function.
+ * @param pvArg [IN] specifies the argument passed to the work item function.
+ * @param nParam [IN] specifies the parameter passed to the work item function.
+ * @param pxHigherPriorityTaskWoken [OUT] set to `pdTRUE` if the deferred work queue task has a higher priority
+ *        than the running one.
+ * @return \a SYS_NO_ERROR_CODE if success, SYS_TASK_QUEUE_FULL_ERROR_CODE if the ring is full.
+ */
+sys_error_code_t DWQSubmitFromISR(pDWQWorkFunc_t pfWork, void *pvArg, uint32_t nParam, BaseType_t *pxHigherPriorityTaskWoken);
+
+/**
+ * Submit a work item from a task.
+ * @sa DWQSubmitFromISR
+ *
+ * @param pfWork [IN] specifies the work item function.
+ * @param pvArg [IN] specifies the argument passed to the work item function.
+ * @param nParam [IN] specifies the parameter passed to the work item function.
+ * @return \a SYS_NO_ERROR_CODE if success, SYS_TASK_QUEUE_FULL_ERROR_CODE if the ring is full.
+ */
+sys_error_code_t DWQSubmit(pDWQWorkFunc_t pfWork, void *pvArg, uint32_t nParam);
+
+/**
+ * Get the statistics of the deferred work queue.
+ *
+ * @return a copy of the statistics.
+ */
+DWQStats DWQGetStats(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_DEFERREDWORKQUEUE_H_ */
@@ -0,0 +1,108 @@
+/**
+ ******************************************************************************
+ * @file    DeferredWorkQueue_vtbl.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief
+ *
+ * TODO - insert here the file description
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_DEFERREDWORKQUEUE_VTBL_H_
+#define INCLUDE_SERVICES_DEFERREDWORKQUEUE_VTBL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "DeferredWorkQueue.h"
+#include "AManagedTaskEx_vtbl.h"
+
+
+/**
+ * A slot of the submission ring.
+ */
+typedef struct _DWQSlot {
+  /**
+   * Specifies the sequence number of the slot. The slot can be written by the submitter that reserved the position
+   * nSequence, and it can be read by the task when nSequence is equal to the position + 1.
+   */
+  volatile uint32_t nSequence;
+
+  /**
+   * Specifies the work item function.
+   */
+  pDWQWorkFunc_t pfWork;
+
+  /**
+   * Specifies the argument of the work item function.
+   */
+  void *pvArg;
+
+  /**
+   * Specifies the parameter of the work item function.
+   */
+  uint32_t nParam;
+} DWQSlot;
+
+/**
+ * The deferred work queue task.
+ */
+struct _DeferredWorkQueue {
+  /**
+   * Base class object.
+   */
+  AManagedTaskEx super;
+
+  /**
+   * Specifies the next position of the ring reserved by a submitter.
+   */
+  volatile uint32_t m_nHead;
+
+  /**
+   * Specifies the next position of the ring read by the task.
+   */
+  uint32_t m_nTail;
+
+  /**
+   * Specifies the submission ring.
+   */
+  DWQSlot m_xRing[DWQ_CFG_RING_SIZE];
+
+  /**
+   * Statistics.
+   */
+  DWQStats m_xStats;
+};
+
+
+// AManagedTask virtual functions
+sys_error_code_t DWQ_vtblHardwareInit(AManagedTask *_this, void *pParams); ///< @sa AMTHardwareInit
+sys_error_code_t DWQ_vtblOnCreateTask(AManagedTask *_this, TaskFunction_t *pvTaskCode, const char **pcName, unsigned short *pnStackDepth, void **pParams, UBaseType_t *pxPriority); ///< @sa AMTOnCreateTask
+sys_error_code_t DWQ_vtblDoEnterPowerMode(AManagedTask *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode); ///< @sa AMTDoEnterPowerMode
+sys_error_code_t DWQ_vtblHandleError(AManagedTask *_this, SysEvent xError); ///< @sa AMTHandleError
+sys_error_code_t DWQ_vtblOnEnterTaskControlLoop(AManagedTask *_this); ///< @sa AMTOnEnterTaskControlLoop
+
+// AManagedTaskEx virtual functions
+sys_error_code_t DWQ_vtblForceExecuteStep(AManagedTaskEx *_this, EPowerMode eActivePowerMode); ///< @sa AMTExForceExecuteStep
+sys_error_code_t DWQ_vtblOnEnterPowerMode(AManagedTaskEx *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode); ///< @sa AMTExOnEnterPowerMode
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* INCLUDE_SERVICES_DEFERREDWORKQUEUE_VTBL_H_ */
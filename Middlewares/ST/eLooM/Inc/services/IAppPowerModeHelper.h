@@ -57,6 +57,21 @@ inline sys_error_code_t IapmhInit(IAppPowerModeHelper *_this);
  */
 inline EPowerMode IapmhComputeNewPowerMode(IAppPowerModeHelper *_this, const SysEvent xEvent);
 
+/**
+ * Compute the new power mode depending on the input event, assuming that the system is in a given power mode.
+ * It must not change the state of the object. It is used by the INIT task to fold a sequence of pending
+ * power mode events into the final target power mode.
+ * The entry of the virtual table is optional: it is the last one, so an application implementation
+ * written before it was added leaves it NULL. In that case the function falls back to IapmhComputeNewPowerMode()
+ * and eFromPowerMode is ignored, so INIT does not fold the events.
+ *
+ * @param _this [IN] specifies a pointer to the object.
+ * @param eFromPowerMode [IN] specifies the power mode used as starting point.
+ * @param xEvent [IN] an power mode input event.
+ * @return the power mode that the system should enter due to the event, starting from eFromPowerMode.
+ */
+inline EPowerMode IapmhComputeNewPowerModeFrom(IAppPowerModeHelper *_this, const EPowerMode eFromPowerMode, const SysEvent xEvent);
+
 /**
  * Used mainly for debug purpose. It checks if a request power mode transaction is valid.
  *
@@ -67,6 +82,20 @@ inline EPowerMode IapmhComputeNewPowerMode(IAppPowerModeHelper *_this, const Sys
  */
 inline boolean_t IapmhCheckPowerModeTransaction(IAppPowerModeHelper *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
 
+/**
+ * Check if a power mode transaction is valid. Unlike IapmhCheckPowerModeTransaction(), it does not stop the program
+ * execution if the transaction is not valid. It is used by the INIT task to check the transaction obtained by folding
+ * a sequence of power mode events, that can be not valid even if each event is.
+ * The entry of the virtual table is optional, as the one of IapmhComputeNewPowerModeFrom(). If it is NULL
+ * the function falls back to IapmhCheckPowerModeTransaction(), and INIT does not fold the events.
+ *
+ * @param _this [IN] specifies a pointer to the object.
+ * @param eActivePowerMode [IN] species the actual power mode.
+ * @param eNewPowerMode [IN] specifies a new power mode.
+ * @return `TRUE` if the transaction is valid, `FALSE` otherwise.
+ */
+inline boolean_t IapmhIsPowerModeTransactionValid(IAppPowerModeHelper *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
+
 /**
  * Used by the system to enter the new power mode. It is called after all application task are ready for the new power mode.
  *
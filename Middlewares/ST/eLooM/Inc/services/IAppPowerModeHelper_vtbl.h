@@ -49,6 +49,8 @@ struct _IAppPowerModeHelper_vtbl {
   EPowerMode (*GetActivePowerMode)(IAppPowerModeHelper *_this);
   SysPowerStatus (*GetPowerStatus)(IAppPowerModeHelper *_this);
   boolean_t (*IsLowPowerMode)(IAppPowerModeHelper *_this, const EPowerMode ePowerMode);
+  EPowerMode (*ComputeNewPowerModeFrom)(IAppPowerModeHelper *_this, const EPowerMode eFromPowerMode, const SysEvent xEvent);
+  boolean_t (*IsPowerModeTransactionValid)(IAppPowerModeHelper *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
 };
 
 /**
@@ -76,11 +78,23 @@ EPowerMode IapmhComputeNewPowerMode(IAppPowerModeHelper *_this, const SysEvent x
   return _this->vptr->ComputeNewPowerMode(_this, xEvent);
 }
 
+SYS_DEFINE_INLINE
+EPowerMode IapmhComputeNewPowerModeFrom(IAppPowerModeHelper *_this, const EPowerMode eFromPowerMode, const SysEvent xEvent) {
+  return (_this->vptr->ComputeNewPowerModeFrom != NULL) ? _this->vptr->ComputeNewPowerModeFrom(_this, eFromPowerMode, xEvent)
+                                                         : _this->vptr->ComputeNewPowerMode(_this, xEvent);
+}
+
 SYS_DEFINE_INLINE
 boolean_t IapmhCheckPowerModeTransaction(IAppPowerModeHelper *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode) {
   return _this->vptr->CheckPowerModeTransaction(_this, eActivePowerMode, eNewPowerMode);
 }
 
+SYS_DEFINE_INLINE
+boolean_t IapmhIsPowerModeTransactionValid(IAppPowerModeHelper *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode) {
+  return (_this->vptr->IsPowerModeTransactionValid != NULL) ? _this->vptr->IsPowerModeTransactionValid(_this, eActivePowerMode, eNewPowerMode)
+                                                             : _this->vptr->CheckPowerModeTransaction(_this, eActivePowerMode, eNewPowerMode);
+}
+
 SYS_DEFINE_INLINE
 sys_error_code_t IapmhDidEnterPowerMode(IAppPowerModeHelper *_this, EPowerMode ePowerMode) {
   return _this->vptr->DidEnterPowerMode(_this, ePowerMode);
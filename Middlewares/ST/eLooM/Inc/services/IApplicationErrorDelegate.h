@@ -63,6 +63,7 @@ inline sys_error_code_t IAEDOnStartApplication(IApplicationErrorDelegate *_this,
 
 /**
  * The INIT task uses this function to deliver an error event to the application error manager delegate object.
+ * The attachment of the event, if any, is available with SysEvtGetAttachment() until the function returns.
  *
  * @param _this [IN] specifies a pointer to an IApplicationErrorDelegate object.
  * @param pxContext [IN] specifies a pointer to the application context.
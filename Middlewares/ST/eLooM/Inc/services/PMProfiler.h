@@ -0,0 +1,312 @@
+/**
+ ******************************************************************************
+ * @file    PMProfiler.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Profiler of the power mode transactions.
+ *
+ * The profiler measures where the time goes in a power mode transaction executed by INIT:
+ * - the duration of each phase of the transaction (see ::EPMPPhase).
+ * - the duration of each PM class.
+ * - the duration of AMTExOnEnterPowerMode() and AMTDoEnterPowerMode() for each task.
+ *
+ * The statistics (min / max / mean and an histogram of the total duration) are kept for each
+ * transaction pair (active power mode, new power mode). All durations are in microseconds,
+ * measured with the DWT cycle counter.
+ *
+ * The profiler is enabled with INIT_TASK_CFG_ENABLE_PM_PROFILER. When it is disabled the
+ * instrumentation macros expand to nothing.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_PMPROFILER_H_
+#define INCLUDE_SERVICES_PMPROFILER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "systp.h"
+#include "systypes.h"
+#include "syslowpower.h"
+#include "AManagedTaskEx.h"
+#include "AManagedTaskEx_vtbl.h"
+
+
+#ifndef INIT_TASK_CFG_ENABLE_PM_PROFILER
+#define INIT_TASK_CFG_ENABLE_PM_PROFILER      0
+#endif
+
+#ifndef PMP_CFG_MAX_TRANSITIONS
+#define PMP_CFG_MAX_TRANSITIONS               8U
+#endif
+
+#ifndef PMP_CFG_MAX_TASKS
+#define PMP_CFG_MAX_TASKS                     16U
+#endif
+
+/**
+ * Number of bins of the histogram of the transaction duration. The bin 0 counts the
+ * transactions shorter than 1 ms, the bin n counts the transactions in [2^(n-1), 2^n) ms,
+ * and the last bin counts all the longer transactions.
+ */
+#ifndef PMP_CFG_HISTOGRAM_BINS
+#define PMP_CFG_HISTOGRAM_BINS                8U
+#endif
+
+/**
+ * Phases of a power mode transaction.
+ */
+typedef enum _EPMPPhase {
+  E_PMP_PHASE_ON_ENTER = 0,   ///< AMTExOnEnterPowerMode() for all the tasks.
+  E_PMP_PHASE_DO_ENTER,       ///< AMTDoEnterPowerMode() for all the PM classes, waits included.
+  E_PMP_PHASE_WAIT,           ///< INIT waits for the tasks not ready for the power mode switch.
+  E_PMP_PHASE_DID_ENTER,      ///< IapmhDidEnterPowerMode().
+  E_PMP_PHASE_RESUME,         ///< the tasks are resumed.
+  E_PMP_PHASE_TOTAL,          ///< the whole transaction.
+  E_PMP_PHASE_COUNT
+} EPMPPhase;
+
+/**
+ * Phases of a power mode transaction of a task.
+ */
+typedef enum _EPMPTaskPhase {
+  E_PMP_TASK_PHASE_ON_ENTER = 0,  ///< AMTExOnEnterPowerMode().
+  E_PMP_TASK_PHASE_DO_ENTER,      ///< AMTDoEnterPowerMode().
+  E_PMP_TASK_PHASE_COUNT
+} EPMPTaskPhase;
+
+/**
+ * Create a type name for _PMPStats.
+ */
+typedef struct _PMPStats PMPStats;
+
+/**
+ * Statistics of a duration.
+ */
+struct _PMPStats {
+  /**
+   * Specifies the number of samples.
+   */
+  uint32_t nCount;
+
+  /**
+   * Specifies the minimum duration in us.
+   */
+  uint32_t nMin;
+
+  /**
+   * Specifies the maximum duration in us.
+   */
+  uint32_t nMax;
+
+  /**
+   * Specifies the sum of the durations in us. It is used to compute the mean.
+   */
+  uint64_t nSum;
+};
+
+/**
+ * Create a type name for _PMPTransitionStats.
+ */
+typedef struct _PMPTransitionStats PMPTransitionStats;
+
+/**
+ * Statistics of a transaction pair.
+ */
+struct _PMPTransitionStats {
+  /**
+   * Specifies the active power mode.
+   */
+  EPowerMode eFrom;
+
+  /**
+   * Specifies the new power mode.
+   */
+  EPowerMode eTo;
+
+  /**
+   * Specifies the statistics of each phase.
+   */
+  PMPStats xPhase[E_PMP_PHASE_COUNT];
+
+  /**
+   * Specifies the statistics of each PM class. A transaction is added only to the PM classes with at least one task
+   * that did enter the new power mode.
+   */
+  PMPStats xClass[AMT_PM_CLASS_COUNT];
+
+  /**
+   * Specifies the histogram of the total duration. See ::PMP_CFG_HISTOGRAM_BINS.
+   */
+  uint32_t nHistogram[PMP_CFG_HISTOGRAM_BINS];
+};
+
+/**
+ * Create a type name for _PMPTaskStats.
+ */
+typedef struct _PMPTaskStats PMPTaskStats;
+
+/**
+ * Statistics of a managed task, for all the transaction pairs.
+ */
+struct _PMPTaskStats {
+  /**
+   * Specifies the task.
+   */
+  AManagedTask *pxTask;
+
+  /**
+   * Specifies the statistics of each phase of the task.
+   */
+  PMPStats xPhase[E_PMP_TASK_PHASE_COUNT];
+};
+
+
+#if (INIT_TASK_CFG_ENABLE_PM_PROFILER == 1)
+
+#define PMP_TRANSACTION_BEGIN(from, to)       PMPTransactionBegin((from), (to))
+#define PMP_TRANSACTION_END()                 PMPTransactionEnd()
+#define PMP_PHASE_BEGIN(phase)                PMPPhaseBegin((phase))
+#define PMP_PHASE_END(phase)                  PMPPhaseEnd((phase))
+#define PMP_CLASS_BEGIN(pm_class)             PMPClassBegin((pm_class))
+#define PMP_CLASS_END(pm_class)               PMPClassEnd((pm_class))
+#define PMP_TASK_BEGIN()                      PMPTaskBegin()
+#define PMP_TASK_END(task, phase)             PMPTaskEnd((task), (phase))
+#define PMP_TASK_DELETED(task)                PMPOnTaskDeleted((task))
+
+
+// Public API declaration
+//***********************
+
+/**
+ * Start a new transaction. It is used by INIT.
+ *
+ * @param eFrom [IN] specifies the active power mode.
+ * @param eTo [IN] specifies the new power mode.
+ */
+void PMPTransactionBegin(const EPowerMode eFrom, const EPowerMode eTo);
+
+/**
+ * Complete the current transaction and update the statistics of its transaction pair. It is used by INIT.
+ */
+void PMPTransactionEnd(void);
+
+/**
+ * Start the measure of a phase. A phase can be measured many times in a transaction, and the
+ * durations are accumulated. It is used by INIT.
+ *
+ * @param ePhase [IN] specifies a phase.
+ */
+void PMPPhaseBegin(const EPMPPhase ePhase);
+
+/**
+ * Stop the measure of a phase. It is used by INIT.
+ *
+ * @param ePhase [IN] specifies a phase.
+ */
+void PMPPhaseEnd(const EPMPPhase ePhase);
+
+/**
+ * Start the measure of a PM class. It is used by INIT.
+ *
+ * @param ePMClass [IN] specifies a PM class.
+ */
+void PMPClassBegin(const EPMClass ePMClass);
+
+/**
+ * Stop the measure of a PM class. It is used by INIT.
+ *
+ * @param ePMClass [IN] specifies a PM class.
+ */
+void PMPClassEnd(const EPMClass ePMClass);
+
+/**
+ * Start the measure of a task function. It is used by INIT.
+ */
+void PMPTaskBegin(void);
+
+/**
+ * Stop the measure of a task function and update the statistics of the task. It is used by INIT.
+ *
+ * @param pxTask [IN] specifies a task.
+ * @param ePhase [IN] specifies the measured function.
+ */
+void PMPTaskEnd(AManagedTask *pxTask, const EPMPTaskPhase ePhase);
+
+/**
+ * Remove the statistics of a task. It is used by INIT when the task is unloaded (see SysUnloadTask()),
+ * so the profiler never keeps a pointer to a task object released by the application.
+ *
+ * @param pxTask [IN] specifies a task.
+ */
+void PMPOnTaskDeleted(const AManagedTask *pxTask);
+
+/**
+ * Get the statistics of a transaction pair.
+ *
+ * @param eFrom [IN] specifies the active power mode.
+ * @param eTo [IN] specifies the new power mode.
+ * @return the statistics of the transaction pair, or NULL if the transaction has never been executed.
+ */
+const PMPTransitionStats *PMPGetTransitionStats(const EPowerMode eFrom, const EPowerMode eTo);
+
+/**
+ * Get the statistics of a task.
+ *
+ * @param pxTask [IN] specifies a task.
+ * @return the statistics of the task, or NULL if the task has never done a transaction. The pointer is not valid
+ *         anymore when a task is unloaded.
+ */
+const PMPTaskStats *PMPGetTaskStats(const AManagedTask *pxTask);
+
+/**
+ * Get the mean of a duration.
+ *
+ * @param pxStats [IN] specifies the statistics of a duration.
+ * @return the mean duration in us.
+ */
+uint32_t PMPGetMean(const PMPStats *pxStats);
+
+/**
+ * Clear all the statistics.
+ */
+void PMPReset(void);
+
+/**
+ * Print the statistics with the system log, one line for each transaction pair, PM class and task.
+ */
+void PMPDump(void);
+
+#else
+
+#define PMP_TRANSACTION_BEGIN(from, to)
+#define PMP_TRANSACTION_END()
+#define PMP_PHASE_BEGIN(phase)
+#define PMP_PHASE_END(phase)
+#define PMP_CLASS_BEGIN(pm_class)
+#define PMP_CLASS_END(pm_class)
+#define PMP_TASK_BEGIN()
+#define PMP_TASK_END(task, phase)
+#define PMP_TASK_DELETED(task)
+
+#endif /* INIT_TASK_CFG_ENABLE_PM_PROFILER */
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_PMPROFILER_H_ */
@@ -0,0 +1,226 @@
+/**
+ ******************************************************************************
+ * @file    PMTransitionTable.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Table driven power mode state machine.
+ *
+ * A PM transition table maps each (power mode, event source, event parameter) to the next power mode
+ * of the system. It is a constant table generated at build time from a list of transitions, so:
+ * - the next power mode is computed with an O(1) lookup.
+ * - a transition that refers a power mode, a source or a parameter out of the table is a build error.
+ * - two transitions with the same (power mode, event source, event parameter) are a build error
+ *   ("redeclaration of enumerator"). The check compares the tokens of the transitions, so the power modes,
+ *   the sources and the parameters must be written always with the same identifier or literal. Two spellings
+ *   of the same value are still reported by the compiler with the -Woverride-init warning (enabled by -Wextra).
+ * - a transition with a specific parameter and a PMTT_ANY_PARAM transition of the same source are not
+ *   a conflict: the specific one has precedence.
+ * - an event whose source is out of the table is not part of the state machine. The IAppPowerModeHelper
+ *   must check it with PMTTHasEventSource() and process it as before the table (usually it is an error).
+ * - the set of valid power mode transactions is derived from the same list, so an IAppPowerModeHelper using
+ *   the table never computes an illegal transaction.
+ *
+ * The application defines the list of transitions with an X-macro, and then the table with PMTT_DEFINE():
+ *
+ *     #define APP_PM_TRANSITIONS(X) \
+ *       X(E_POWER_MODE_STATE1,  SYS_PM_EVT_SRC_PB, SYS_PM_EVT_PARAM_SHORT_PRESS, E_POWER_MODE_TEST) \
+ *       X(E_POWER_MODE_TEST,    SYS_PM_EVT_SRC_PB, PMTT_ANY_PARAM,               E_POWER_MODE_STATE1)
+ *
+ *     PMTT_DEFINE(s_xAppPMTable, E_POWER_MODE_NONE, 4U, 4U, APP_PM_TRANSITIONS);
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_PMTRANSITIONTABLE_H_
+#define INCLUDE_SERVICES_PMTRANSITIONTABLE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "systp.h"
+#include "systypes.h"
+#include "syslowpower.h"
+
+
+/**
+ * Event parameter used in a transition to match all the parameters of an event source.
+ * A transition with a specific parameter has precedence.
+ */
+#define PMTT_ANY_PARAM                        0U
+
+/**
+ * Maximum number of event sources. It is given by the size of the SysEvent::nSource field.
+ */
+#define PMTT_MAX_SOURCES                      8U
+
+/**
+ * Maximum number of event parameters. It is given by the size of the SysEvent::nParam field.
+ */
+#define PMTT_MAX_PARAMS                       32U
+
+/**
+ * X-macro used by PMTT_DEFINE() to generate the entries of the next power mode table.
+ * The value 0 means no transition, so the table stores the next power mode + 1.
+ */
+#define PMTT_NEXT_ENTRY(from, src, param, to)          [(from)][(src)][(param)] = (uint8_t)((to) + 1U),
+
+/**
+ * X-macro used by PMTT_DEFINE() to generate one enumerator for each transition. Two transitions with the
+ * same (power mode, event source, event parameter) generate the same enumerator.
+ */
+#define PMTT_KEY_ENTRY(from, src, param, to)           PMTT_KEY_##from##_##src##_##param,
+
+/**
+ * Define a constant PM transition table. An index out of the table in a transition is detected by the compiler
+ * ("array index in initializer exceeds array bounds"). A duplicated transition is detected by the enumeration
+ * declared in the block of the never called name##_CheckTransitions() function, so the enumerators of two tables
+ * do not collide.
+ *
+ * @param name [IN] specifies the name of the ::PMTransitionTable object.
+ * @param states [IN] specifies the number of power modes.
+ * @param sources [IN] specifies the number of event sources. It must be less or equal to ::PMTT_MAX_SOURCES.
+ * @param params [IN] specifies the number of event parameters. It must be less or equal to ::PMTT_MAX_PARAMS.
+ * @param TRANSITIONS [IN] specifies an X-macro listing the transitions as X(from, src, param, to).
+ */
+#define PMTT_DEFINE(name, states, sources, params, TRANSITIONS) \
+  typedef char name##_size_check[(((sources) <= PMTT_MAX_SOURCES) && ((params) <= PMTT_MAX_PARAMS) && ((states) < 255U)) ? 1 : -1]; \
+  static inline void name##_CheckTransitions(void) { enum { TRANSITIONS(PMTT_KEY_ENTRY) PMTT_KEY_COUNT }; } \
+  static const uint8_t name##_anNext[(states)][(sources)][(params)] = { TRANSITIONS(PMTT_NEXT_ENTRY) }; \
+  static const PMTransitionTable name = { &name##_anNext[0][0][0], (uint8_t)(states), (uint8_t)(sources), (uint8_t)(params) }
+
+/**
+ * Create a type name for _PMTransitionTable.
+ */
+typedef struct _PMTransitionTable PMTransitionTable;
+
+/**
+ * Constant PM transition table. Use PMTT_DEFINE() to define an object of this type.
+ */
+struct _PMTransitionTable {
+  /**
+   * Specifies the table [states][sources][params] of the next power mode + 1. 0 means no transition.
+   */
+  const uint8_t *m_pnNext;
+
+  /**
+   * Specifies the number of power modes.
+   */
+  uint8_t m_nStates;
+
+  /**
+   * Specifies the number of event sources.
+   */
+  uint8_t m_nSources;
+
+  /**
+   * Specifies the number of event parameters.
+   */
+  uint8_t m_nParams;
+};
+
+
+// Public API declaration
+//***********************
+
+/**
+ * Compute the new power mode starting from a given power mode.
+ * An event without a transition, or out of the table, does not change the power mode.
+ *
+ * @param _this [IN] specifies a pointer to the table.
+ * @param eFromPowerMode [IN] specifies the power mode used as starting point.
+ * @param xEvent [IN] specifies a power mode event.
+ * @return the new power mode.
+ */
+inline EPowerMode PMTTComputeNewPowerMode(const PMTransitionTable *_this, const EPowerMode eFromPowerMode, const SysEvent xEvent);
+
+/**
+ * Check if the source of an event is in the table. An event of a source out of the table is not part of the
+ * power mode state machine, and PMTTComputeNewPowerMode() ignores it.
+ *
+ * @param _this [IN] specifies a pointer to the table.
+ * @param xEvent [IN] specifies a power mode event.
+ * @return `TRUE` if the source of the event is in the table, `FALSE` otherwise.
+ */
+inline boolean_t PMTTHasEventSource(const PMTransitionTable *_this, const SysEvent xEvent);
+
+/**
+ * Check if a power mode transaction is in the table, that is at least one event moves the system from
+ * eActivePowerMode to eNewPowerMode. It visits only the row of eActivePowerMode.
+ *
+ * @param _this [IN] specifies a pointer to the table.
+ * @param eActivePowerMode [IN] species the actual power mode.
+ * @param eNewPowerMode [IN] specifies a new power mode.
+ * @return `TRUE` if the transaction is valid, `FALSE` otherwise.
+ */
+inline boolean_t PMTTIsTransactionValid(const PMTransitionTable *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
+
+
+// Inline functions definition
+// ***************************
+
+SYS_DEFINE_INLINE
+EPowerMode PMTTComputeNewPowerMode(const PMTransitionTable *_this, const EPowerMode eFromPowerMode, const SysEvent xEvent) {
+  assert_param(_this != NULL);
+  EPowerMode eNewPowerMode = eFromPowerMode;
+  const uint8_t *pnRow;
+  uint8_t nNext = 0U;
+
+  if (((uint32_t)eFromPowerMode < _this->m_nStates) && (xEvent.xEvent.nSource < _this->m_nSources)) {
+    pnRow = &_this->m_pnNext[(((uint32_t)eFromPowerMode * _this->m_nSources) + xEvent.xEvent.nSource) * _this->m_nParams];
+    if (xEvent.xEvent.nParam < _this->m_nParams) {
+      nNext = pnRow[xEvent.xEvent.nParam];
+    }
+    if (nNext == 0U) {
+      nNext = pnRow[PMTT_ANY_PARAM];
+    }
+    if (nNext != 0U) {
+      eNewPowerMode = (EPowerMode)(nNext - 1U);
+    }
+  }
+
+  return eNewPowerMode;
+}
+
+SYS_DEFINE_INLINE
+boolean_t PMTTHasEventSource(const PMTransitionTable *_this, const SysEvent xEvent) {
+  assert_param(_this != NULL);
+
+  return (xEvent.xEvent.nSource < _this->m_nSources) ? TRUE : FALSE;
+}
+
+SYS_DEFINE_INLINE
+boolean_t PMTTIsTransactionValid(const PMTransitionTable *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode) {
+  assert_param(_this != NULL);
+  boolean_t bRes = FALSE;
+  const uint8_t *pnRow;
+  uint32_t nRowSize;
+
+  if (((uint32_t)eActivePowerMode < _this->m_nStates) && ((uint32_t)eNewPowerMode < _this->m_nStates)) {
+    nRowSize = (uint32_t)_this->m_nSources * _this->m_nParams;
+    pnRow = &_this->m_pnNext[(uint32_t)eActivePowerMode * nRowSize];
+    for (uint32_t i = 0; (i < nRowSize) && !bRes; ++i) {
+      bRes = pnRow[i] == (uint8_t)((uint32_t)eNewPowerMode + 1U) ? TRUE : FALSE;
+    }
+  }
+
+  return bRes;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_PMTRANSITIONTABLE_H_ */
@@ -0,0 +1,157 @@
+/**
+ ******************************************************************************
+ * @file    StackGuard.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   MPU based stack overflow guard.
+ *
+ * The stack guard uses one MPU region to protect the lowest 32 bytes of the stack of the running task.
+ * The region is moved at each context switch (`traceTASK_SWITCHED_IN()`), so the cost is a few register writes
+ * instead of the pattern check of `configCHECK_FOR_STACK_OVERFLOW`. A stack overflow triggers a MemManage fault
+ * at the first write in the guard, before the overflow corrupts the memory.
+ *
+ * The guard catches only an overflow that writes in it. A function with a frame larger than 32 bytes can move
+ * the stack pointer below the guard and write under it without touching it, for example with a big local array
+ * that is not written from its lowest address. Such an overflow corrupts the memory below the stack and it is not
+ * detected. The tasks with big frames need a stack depth with a margin, checked with STKGGetFreeStack().
+ *
+ * The MemManage fault handler calls STKGOnMemManageFault(). If the fault is a stack overflow it records the identity
+ * of the task (see ::SysStackOverflow) in a RAM section that is not initialized at startup, then it calls
+ * `vApplicationStackOverflowHook()`. No kernel service can be used in the fault handler, so the hook should reset
+ * the MCU (`NVIC_SystemReset()`). After the reset INIT posts the error event (::SYS_ERR_EVT_SRC_STACK_GUARD,
+ * ::SYS_ERR_EVT_PARAM_STACK_OVERFLOW), with the record as attachment, to the IApplicationErrorDelegate.
+ * The linker script must place the `.noinit` section in a NOLOAD region of the RAM.
+ *
+ * On the ARMv7-M MPU also a read in the guard triggers the fault, so the high-water mark of the running task must be
+ * computed with STKGGetFreeStack() instead of `uxTaskGetStackHighWaterMark()`, that scans the stack from its lowest address.
+ *
+ * The guard is enabled with SYS_CFG_ENABLE_MPU_STACK_GUARD. Because of the alignment of the MPU region, a task can
+ * use up to 63 bytes less than its stack depth. The region is privileged read only on the ARMv8-M MPU, so only
+ * a write in the guard triggers the fault.
+ *
+ * The placement of the guard and the attribution of the faults are implemented in StackGuardLayout.h, that has no
+ * dependency on the MCU, so they can be tested in a host build (see StackGuardHost.h).
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_STACKGUARD_H_
+#define INCLUDE_SERVICES_STACKGUARD_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "systp.h"
+#include "systypes.h"
+#include "syserror.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+
+#ifndef SYS_CFG_ENABLE_MPU_STACK_GUARD
+#define SYS_CFG_ENABLE_MPU_STACK_GUARD        0
+#endif
+
+#ifndef STKG_CFG_MPU_REGION
+/**
+ * Specifies the MPU region used for the guard. The highest region has the highest priority.
+ */
+#define STKG_CFG_MPU_REGION                   7U
+#endif
+
+/**
+ * Attachment of the error event (::SYS_ERR_EVT_SRC_STACK_GUARD, ::SYS_ERR_EVT_PARAM_STACK_OVERFLOW).
+ * If the event pool is empty the event is posted without attachment. The event is posted after the reset,
+ * so the task is identified by its name.
+ */
+typedef struct _SysStackOverflow {
+  /**
+   * Specifies the name of the task that overflowed its stack.
+   */
+  char pcTaskName[configMAX_TASK_NAME_LEN];
+
+  /**
+   * Specifies the faulting address, or zero if the fault occurred during the exception stacking.
+   */
+  uint32_t nFaultAddress;
+} SysStackOverflow;
+
+
+#if (SYS_CFG_ENABLE_MPU_STACK_GUARD == 1)
+
+#if !defined(__MPU_PRESENT) || (__MPU_PRESENT != 1)
+#error The stack guard requires an MCU with the MPU.
+#endif
+
+#define STKG_INIT()                           STKGInit()
+#define STKG_REPORT_LAST_OVERFLOW()           STKGReportLastOverflow()
+
+
+// Public API declaration
+//***********************
+
+/**
+ * Enable the MPU, with the default memory map as background region, and the MemManage fault.
+ * It is used by the system before the scheduler starts.
+ */
+void STKGInit(void);
+
+/**
+ * Move the guard to the stack of the task that is going to run. It is called by the kernel through
+ * the `traceTASK_SWITCHED_IN()` macro defined in the FreeRTOSConfig.h file:
+ *
+ * ~~~{.c}
+ * #define traceTASK_SWITCHED_IN()  STKGOnTaskSwitchedIn(pxCurrentTCB->pxStack)
+ * ~~~
+ *
+ * @param pvStackBottom [IN] specifies the lowest address of the stack of the task.
+ */
+void STKGOnTaskSwitchedIn(const void *pvStackBottom);
+
+/**
+ * Get the high-water mark of the stack of the running task without reading the guard. It is the value of
+ * `uxTaskGetStackHighWaterMark(NULL)`, but the guard and the memory below it are counted as free without scanning them.
+ *
+ * @return the minimum free stack of the running task, in word, since the task has been created.
+ */
+uint32_t STKGGetFreeStack(void);
+
+/**
+ * Post the error event of the stack overflow recorded before the last reset, if any. It is used by INIT when
+ * the IApplicationErrorDelegate has been started.
+ */
+void STKGReportLastOverflow(void);
+
+/**
+ * Check if a MemManage fault is a stack overflow of the running task. If it is, the function records it and does
+ * not return. It must be called by the MemManage_Handler().
+ *
+ * @return `FALSE` if the fault is not a stack overflow.
+ */
+boolean_t STKGOnMemManageFault(void);
+
+#else
+
+#define STKG_INIT()
+#define STKG_REPORT_LAST_OVERFLOW()
+
+#endif /* SYS_CFG_ENABLE_MPU_STACK_GUARD */
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_STACKGUARD_H_ */
@@ -0,0 +1,101 @@
+/**
+ ******************************************************************************
+ * @file    StackGuardHost.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Host build of the stack guard.
+ *
+ * In a host (POSIX) build a page protected with `mprotect()` stands in for the MPU region of the stack guard,
+ * and a `SIGSEGV` handler stands in for the MemManage fault handler. The placement of the guard and the attribution
+ * of the faults are the same functions used on the MCU (see StackGuardLayout.h), so they can be tested without
+ * the target:
+ *
+ * ~~~{.c}
+ * static sigjmp_buf s_xEnv;
+ *
+ * static void OnOverflow(const void *pvTask, uintptr_t nFaultAddress) {
+ *   siglongjmp(s_xEnv, 1);
+ * }
+ *
+ * STKGHostInit(OnOverflow);
+ * STKGHostOnTaskSwitchedIn(&xTask, pnStack); // pnStack is a page aligned buffer of the fake task.
+ * if (sigsetjmp(s_xEnv, 1) == 0) {
+ *   pnStack[0] = 0; // write in the guard.
+ * }
+ * ~~~
+ *
+ * The host build is enabled with STKG_CFG_HOST_BUILD. The guard is one page, and it cannot be read, as the
+ * region of the ARMv7-M MPU. The host test is in `Tests/StackGuard` (run `make` in that folder).
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_STACKGUARDHOST_H_
+#define INCLUDE_SERVICES_STACKGUARDHOST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "StackGuardLayout.h"
+
+
+#if defined(STKG_CFG_HOST_BUILD)
+
+/**
+ * Hook called by the `SIGSEGV` handler when a fault is a stack overflow. It stands in for
+ * `vApplicationStackOverflowHook()`. The guard is not protected when the hook is called. If the hook returns
+ * the process is aborted.
+ *
+ * @param pvTask [IN] specifies the task that owns the stack.
+ * @param nFaultAddress [IN] specifies the faulting address.
+ */
+typedef void (*STKGHostOverflowHook_t)(const void *pvTask, uintptr_t nFaultAddress);
+
+
+// Public API declaration
+//***********************
+
+/**
+ * Install the `SIGSEGV` handler.
+ *
+ * @param pfHook [IN] specifies the hook called when a fault is a stack overflow.
+ * @return 0 if success, -1 otherwise (see `errno`).
+ */
+int STKGHostInit(STKGHostOverflowHook_t pfHook);
+
+/**
+ * Move the guard to the stack of a task. It stands in for STKGOnTaskSwitchedIn().
+ *
+ * @param pvTask [IN] specifies the task.
+ * @param pvStackBottom [IN] specifies the lowest address of the stack of the task.
+ * @return 0 if success, -1 otherwise (see `errno`).
+ */
+int STKGHostOnTaskSwitchedIn(const void *pvTask, void *pvStackBottom);
+
+/**
+ * Get the size of the guard, that is the page size of the host.
+ *
+ * @return the size of the guard in byte.
+ */
+uintptr_t STKGHostGetGuardSize(void);
+
+#endif /* STKG_CFG_HOST_BUILD */
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_STACKGUARDHOST_H_ */
@@ -0,0 +1,78 @@
+/**
+ ******************************************************************************
+ * @file    StackGuardLayout.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Placement of the stack guard and attribution of the faults.
+ *
+ * These functions do not depend on the MCU and on the kernel, so the same logic is used by the MPU guard
+ * (see StackGuard.h) and by the host build, where a page protected with `mprotect()` stands in for
+ * the MPU region (see StackGuardHost.h).
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_STACKGUARDLAYOUT_H_
+#define INCLUDE_SERVICES_STACKGUARDLAYOUT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdint.h>
+#include "systypes.h"
+
+
+/* Public API declaration */
+/**************************/
+
+/**
+ * Get the base address of the guard of a stack. The guard is the lowest block of the stack aligned to
+ * the guard size, because the base of a protected region must be aligned to its size.
+ *
+ * @param nStackBottom [IN] specifies the lowest address of the stack.
+ * @param nGuardSize [IN] specifies the size in byte of the guard. It must be a power of 2.
+ * @return the base address of the guard.
+ */
+static inline uintptr_t STKGLayoutGetGuardBase(uintptr_t nStackBottom, uintptr_t nGuardSize);
+
+/**
+ * Check if a faulting address is in the guard.
+ *
+ * @param nGuardBase [IN] specifies the base address of the guard.
+ * @param nGuardSize [IN] specifies the size in byte of the guard.
+ * @param nFaultAddress [IN] specifies the faulting address.
+ * @return `TRUE` if the fault is a stack overflow, `FALSE` otherwise.
+ */
+static inline boolean_t STKGLayoutIsInGuard(uintptr_t nGuardBase, uintptr_t nGuardSize, uintptr_t nFaultAddress);
+
+
+/* Inline functions definition */
+/*******************************/
+
+static inline uintptr_t STKGLayoutGetGuardBase(uintptr_t nStackBottom, uintptr_t nGuardSize) {
+  return (nStackBottom + (nGuardSize - 1U)) & ~(nGuardSize - 1U);
+}
+
+static inline boolean_t STKGLayoutIsInGuard(uintptr_t nGuardBase, uintptr_t nGuardSize, uintptr_t nFaultAddress) {
+  /* an address below the guard wraps around, so one comparison covers both the bounds.*/
+  return ((nFaultAddress - nGuardBase) < nGuardSize) ? TRUE : FALSE;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_STACKGUARDLAYOUT_H_ */
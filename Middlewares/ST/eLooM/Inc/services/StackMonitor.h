@@ -0,0 +1,173 @@
+/**
+ ******************************************************************************
+ * @file    StackMonitor.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Monitor of the stack usage of the managed tasks.
+ *
+ * INIT registers each task of the ::ApplicationContext when it is created, and unregisters it when the task is
+ * unloaded (see SysUnloadTask()). It samples the stack high-water mark of all the tasks after each power mode transaction. The application can sample it also with STKMSample(),
+ * for example periodically during a soak run.
+ * At the end of the run STKMDump() prints, for each task, the used stack and a recommended stack depth
+ * with a safety margin. It can print the recommended depths also as a configuration header, to be copied
+ * in the sysconfig.h file. All sizes are in word (`StackType_t`), as the stack depth of `xTaskCreate()`.
+ *
+ * The monitor is enabled with INIT_TASK_CFG_ENABLE_STACK_MONITOR, and it requires `INCLUDE_uxTaskGetStackHighWaterMark`
+ * in the FreeRTOSConfig.h file. When it is disabled the instrumentation macros expand to nothing.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_STACKMONITOR_H_
+#define INCLUDE_SERVICES_STACKMONITOR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "systp.h"
+#include "systypes.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+
+#ifndef INIT_TASK_CFG_ENABLE_STACK_MONITOR
+#define INIT_TASK_CFG_ENABLE_STACK_MONITOR    0
+#endif
+
+#ifndef STKM_CFG_MAX_TASKS
+#define STKM_CFG_MAX_TASKS                    16U
+#endif
+
+/**
+ * Specifies the safety margin, in percent of the used stack, added to the recommended depth.
+ */
+#ifndef STKM_CFG_MARGIN_PERCENT
+#define STKM_CFG_MARGIN_PERCENT               20U
+#endif
+
+/**
+ * Specifies the minimum safety margin in word. It covers at least an exception stack frame with the FPU context.
+ */
+#ifndef STKM_CFG_MIN_MARGIN
+#define STKM_CFG_MIN_MARGIN                   32U
+#endif
+
+/**
+ * Create a type name for _STKMTaskInfo.
+ */
+typedef struct _STKMTaskInfo STKMTaskInfo;
+
+/**
+ * Stack usage of a task.
+ */
+struct _STKMTaskInfo {
+  /**
+   * Specifies the task.
+   */
+  TaskHandle_t xTaskHandle;
+
+  /**
+   * Specifies the stack depth given to `xTaskCreate()`.
+   */
+  uint32_t nStackDepth;
+
+  /**
+   * Specifies the minimum free stack since the task has been created.
+   */
+  uint32_t nMinFree;
+};
+
+
+#if (INIT_TASK_CFG_ENABLE_STACK_MONITOR == 1)
+
+#if (INCLUDE_uxTaskGetStackHighWaterMark != 1)
+#error The stack monitor requires INCLUDE_uxTaskGetStackHighWaterMark equal to 1.
+#endif
+
+#define STKM_TASK_CREATED(handle, depth)      STKMOnTaskCreated((handle), (depth))
+#define STKM_TASK_DELETED(handle)             STKMOnTaskDeleted((handle))
+#define STKM_SAMPLE()                         STKMSample()
+
+
+// Public API declaration
+//***********************
+
+/**
+ * Register a task. It is used by INIT.
+ *
+ * @param xTaskHandle [IN] specifies the task.
+ * @param nStackDepth [IN] specifies the stack depth given to `xTaskCreate()`.
+ */
+void STKMOnTaskCreated(TaskHandle_t xTaskHandle, uint32_t nStackDepth);
+
+/**
+ * Unregister a task. It is used by INIT before the task is deleted.
+ *
+ * @param xTaskHandle [IN] specifies the task.
+ */
+void STKMOnTaskDeleted(TaskHandle_t xTaskHandle);
+
+/**
+ * Sample the stack high-water mark of all the registered tasks.
+ */
+void STKMSample(void);
+
+/**
+ * Get the number of registered tasks.
+ *
+ * @return the number of registered tasks.
+ */
+uint8_t STKMGetTaskCount(void);
+
+/**
+ * Get the stack usage of a task.
+ *
+ * @param nIndex [IN] specifies the index of the task in [0, STKMGetTaskCount()).
+ * @return the stack usage of the task, or NULL if the index is not valid.
+ */
+const STKMTaskInfo *STKMGetTaskInfo(uint8_t nIndex);
+
+/**
+ * Get the recommended stack depth of a task, that is the used stack plus the safety margin,
+ * rounded up to a multiple of 8 words.
+ *
+ * @param pxInfo [IN] specifies the stack usage of a task.
+ * @return the recommended stack depth in word.
+ */
+uint32_t STKMGetRecommendedDepth(const STKMTaskInfo *pxInfo);
+
+/**
+ * Sample the stack of all the tasks and print the report with the system log, one line for each task.
+ *
+ * @param bConfigHeader [IN] if `TRUE` print also the recommended depths as a configuration header.
+ *        The name of the macro is built from the task name, for example `HW_TASK_CFG_STACK_DEPTH`
+ *        for the task "HW".
+ */
+void STKMDump(boolean_t bConfigHeader);
+
+#else
+
+#define STKM_TASK_CREATED(handle, depth)
+#define STKM_TASK_DELETED(handle)
+#define STKM_SAMPLE()
+
+#endif /* INIT_TASK_CFG_ENABLE_STACK_MONITOR */
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_STACKMONITOR_H_ */
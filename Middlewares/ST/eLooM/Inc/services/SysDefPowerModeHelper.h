@@ -57,7 +57,8 @@ struct _SysDefPowerModeHelper {
 /**************************/
 
 /**
- * Allocate an instance of SysDefPowerModeHelper. It is allocated in the FreeRTOS heap.
+ * Allocate an instance of SysDefPowerModeHelper. It is allocated with SysAlloc(), or it is the only
+ * static instance of the class in static allocation mode (`configSUPPORT_DYNAMIC_ALLOCATION = 0`).
  *
  * @return a pointer to the generic interface ::IApplicationErrorDelegate if success,
  * or SYS_OUT_OF_MEMORY_ERROR_CODE otherwise.
@@ -30,11 +30,13 @@ extern "C" {
 
 sys_error_code_t SysDefPowerModeHelper_vtblInit(IAppPowerModeHelper *this); ///< @sa IapmhInit
 EPowerMode SysDefPowerModeHelper_vtblComputeNewPowerMode(IAppPowerModeHelper *this, const SysEvent xEvent); ///< @sa IapmhComputeNewPowerMode
+EPowerMode SysDefPowerModeHelper_vtblComputeNewPowerModeFrom(IAppPowerModeHelper *this, const EPowerMode eFromPowerMode, const SysEvent xEvent); ///< @sa IapmhComputeNewPowerModeFrom
 boolean_t SysDefPowerModeHelper_vtblCheckPowerModeTransaction(IAppPowerModeHelper *this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode); ///< @sa IapmhCheckPowerModeTransaction
 sys_error_code_t SysDefPowerModeHelper_vtblDidEnterPowerMode(IAppPowerModeHelper *this, EPowerMode ePowerMode); ///< @sa IapmhDidEnterPowerMode
 EPowerMode SysDefPowerModeHelper_vtblGetActivePowerMode(IAppPowerModeHelper *this); ///< @sa IapmhGetActivePowerMode
 SysPowerStatus SysDefPowerModeHelper_vtblGetPowerStatus(IAppPowerModeHelper *this); ///< @sa IapmhGetPowerStatus
 boolean_t SysDefPowerModeHelper_vtblIsLowPowerMode(IAppPowerModeHelper *this, const EPowerMode ePowerMode); ///< @sa IapmhIsLowPowerMode
+boolean_t SysDefPowerModeHelper_vtblIsPowerModeTransactionValid(IAppPowerModeHelper *this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode); ///< @sa IapmhIsPowerModeTransactionValid
 
 
 #ifdef __cplusplus
@@ -0,0 +1,192 @@
+/**
+ ******************************************************************************
+ * @file    SysMemHeap.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Heap of a memory region.
+ *
+ * A heap manages a contiguous memory region, for example the part of an SRAM bank that is not used by the linker.
+ * It uses the same algorithm of the FreeRTOS heap_4: the free blocks are kept in a list sorted by address,
+ * a block is allocated with a first fit search, and a released block is merged with the adjacent free blocks.
+ * The heap keeps the usage statistics of the region.
+ *
+ * The functions must not be called from an ISR.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_SYSMEMHEAP_H_
+#define INCLUDE_SERVICES_SYSMEMHEAP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "systp.h"
+#include "systypes.h"
+#include "syserror.h"
+#include <stddef.h>
+
+
+/**
+ * Create a type name for _SysMemHeapBlock.
+ */
+typedef struct _SysMemHeapBlock SysMemHeapBlock;
+
+/**
+ * Header of a block of the heap.
+ */
+struct _SysMemHeapBlock {
+  /**
+   * Specifies the next free block. It is NULL if the block is allocated.
+   */
+  SysMemHeapBlock *pxNext;
+
+  /**
+   * Specifies the size in byte of the block, header included. The most significant bit is set if the block is allocated.
+   */
+  size_t nSize;
+};
+
+/**
+ * Create a type name for _SysMemHeapStats.
+ */
+typedef struct _SysMemHeapStats SysMemHeapStats;
+
+/**
+ * Usage statistics of a heap.
+ */
+struct _SysMemHeapStats {
+  /**
+   * Specifies the size in byte of the heap.
+   */
+  size_t nSize;
+
+  /**
+   * Specifies the number of free bytes, headers included.
+   */
+  size_t nFreeSize;
+
+  /**
+   * Specifies the minimum number of free bytes since the heap has been initialized.
+   */
+  size_t nMinFreeSize;
+
+  /**
+   * Specifies the size in byte of the largest free block. It is the largest allocation that can succeed.
+   */
+  size_t nLargestFreeBlock;
+
+  /**
+   * Specifies the number of free blocks. A high value means that the heap is fragmented.
+   */
+  uint32_t nFreeBlockCount;
+
+  /**
+   * Specifies the number of allocated blocks.
+   */
+  uint32_t nAllocatedCount;
+
+  /**
+   * Specifies the number of failed allocations.
+   */
+  uint32_t nFailedCount;
+};
+
+/**
+ * Create a type name for _SysMemHeap.
+ */
+typedef struct _SysMemHeap SysMemHeap;
+
+/**
+ * Internal state of a heap.
+ */
+struct _SysMemHeap {
+  /**
+   * Specifies the head of the list of the free blocks. Its size is zero.
+   */
+  SysMemHeapBlock m_xFreeList;
+
+  /**
+   * Specifies the first byte of the region.
+   */
+  uint8_t *m_pnStart;
+
+  /**
+   * Specifies the first byte after the region.
+   */
+  uint8_t *m_pnEnd;
+
+  /**
+   * Usage statistics of the heap. ::SysMemHeapStats::nLargestFreeBlock and ::SysMemHeapStats::nFreeBlockCount
+   * are computed by SysMemHeapGetStats().
+   */
+  SysMemHeapStats m_xStats;
+};
+
+
+// Public API declaration
+//***********************
+
+/**
+ * Initialize a heap. The whole region is one free block.
+ *
+ * @param _this [IN] specifies a heap object.
+ * @param pvStart [IN] specifies the first byte of the region. It is aligned to 8 bytes by the heap.
+ * @param pvEnd [IN] specifies the first byte after the region.
+ * @return SYS_NO_ERROR_CODE if success, SYS_INVALID_PARAMETER_ERROR_CODE if the region is too small.
+ */
+sys_error_code_t SysMemHeapInit(SysMemHeap *_this, void *pvStart, void *pvEnd);
+
+/**
+ * Allocate a block from the heap. The block is aligned to 8 bytes.
+ *
+ * @param _this [IN] specifies a heap object.
+ * @param nSize [IN] specifies the size in byte of the block.
+ * @return a pointer to the block, or NULL if there is no free block large enough.
+ */
+void *SysMemHeapAlloc(SysMemHeap *_this, size_t nSize);
+
+/**
+ * Release a block allocated with SysMemHeapAlloc().
+ *
+ * @param _this [IN] specifies a heap object.
+ * @param pvData [IN] specifies a block of the heap.
+ * @return SYS_NO_ERROR_CODE if success, SYS_INVALID_PARAMETER_ERROR_CODE if pvData is not an allocated block of the heap.
+ */
+sys_error_code_t SysMemHeapFree(SysMemHeap *_this, void *pvData);
+
+/**
+ * Check if a memory address belongs to the region of a heap.
+ *
+ * @param _this [IN] specifies a heap object.
+ * @param pvData [IN] specifies a memory address.
+ * @return `TRUE` if pvData is in the region of the heap, `FALSE` otherwise.
+ */
+boolean_t SysMemHeapContains(SysMemHeap *_this, const void *pvData);
+
+/**
+ * Get the usage statistics of a heap. The list of the free blocks is visited to compute the fragmentation.
+ *
+ * @param _this [IN] specifies a heap object.
+ * @return a copy of the statistics.
+ */
+SysMemHeapStats SysMemHeapGetStats(SysMemHeap *_this);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_SYSMEMHEAP_H_ */
@@ -0,0 +1,222 @@
+/**
+ ******************************************************************************
+ * @file    SysMemPool.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Fixed-block memory pool.
+ *
+ * A pool is a static array of blocks of the same size. The free blocks are linked in a list stored in the blocks
+ * themselves, so the allocation and the release are O(1) and the pool cannot fragment. The pool keeps the high-water
+ * mark of the used blocks and the number of failed allocations, so it can be sized from the measures of a test run.
+ *
+ * A block released twice, or an address that is not a block of the pool, is refused by SysMemPoolFree(). The check
+ * of a block released twice scans the free list with the interrupts disabled, so it is enabled by default only in the
+ * debug builds (see ::SYS_MEM_POOL_CFG_CHECK_OWNERSHIP).
+ *
+ * All the functions can be called also from an ISR.
+ *
+ * ~~~{.c}
+ * SYS_MEM_POOL_DEFINE(s_xDrvPool, sizeof(PushButtonDrv_t), 2U);
+ *
+ * (void)SYS_MEM_POOL_INIT(s_xDrvPool, sizeof(PushButtonDrv_t), 2U);
+ * IDriver *pxDriver = (IDriver*)SysMemPoolAlloc(&s_xDrvPool);
+ * ~~~
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_SYSMEMPOOL_H_
+#define INCLUDE_SERVICES_SYSMEMPOOL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "systp.h"
+#include "systypes.h"
+#include "syserror.h"
+#include <stddef.h>
+
+
+#ifndef SYS_MEM_POOL_CFG_CHECK_OWNERSHIP
+#if defined(DEBUG) || defined(SYS_DEBUG)
+/**
+ * If defined to 1 SysMemPoolFree() checks that the block is not already free.
+ */
+#define SYS_MEM_POOL_CFG_CHECK_OWNERSHIP      1
+#else
+#define SYS_MEM_POOL_CFG_CHECK_OWNERSHIP      0
+#endif
+#endif
+
+/**
+ * Specifies the size in byte of a block able to store an object of nObjSize bytes. The size is rounded up to
+ * a multiple of 8 bytes, so each block is aligned for any object, and it is at least the size of the link
+ * of the free list.
+ */
+#define SYS_MEM_POOL_BLOCK_SIZE(nObjSize)     ((((nObjSize) < sizeof(void*) ? sizeof(void*) : (nObjSize)) + 7U) & ~(size_t)7U)
+
+/**
+ * Define the storage of a pool and the pool object. The storage is named `<name>_anBlocks`. The pool must be
+ * initialized with ::SYS_MEM_POOL_INIT before it is used.
+ *
+ * @param name [IN] specifies the name of the ::SysMemPool object.
+ * @param obj_size [IN] specifies the size in byte of the objects allocated from the pool.
+ * @param count [IN] specifies the number of blocks.
+ */
+#define SYS_MEM_POOL_DEFINE(name, obj_size, count) \
+  static uint64_t name##_anBlocks[((count) * SYS_MEM_POOL_BLOCK_SIZE(obj_size)) / sizeof(uint64_t)]; \
+  static SysMemPool name
+
+/**
+ * Initialize a pool defined with ::SYS_MEM_POOL_DEFINE. The parameters must be the same of the definition.
+ */
+#define SYS_MEM_POOL_INIT(name, obj_size, count) \
+  SysMemPoolInit(&(name), name##_anBlocks, SYS_MEM_POOL_BLOCK_SIZE(obj_size), (uint16_t)(count))
+
+/**
+ * Create a type name for _SysMemPoolStats.
+ */
+typedef struct _SysMemPoolStats SysMemPoolStats;
+
+/**
+ * Usage statistics of a pool.
+ */
+struct _SysMemPoolStats {
+  /**
+   * Specifies the size in byte of a block.
+   */
+  uint16_t nBlockSize;
+
+  /**
+   * Specifies the number of blocks.
+   */
+  uint16_t nBlockCount;
+
+  /**
+   * Specifies the number of allocated blocks.
+   */
+  uint16_t nUsedCount;
+
+  /**
+   * Specifies the maximum number of allocated blocks since the pool has been initialized.
+   */
+  uint16_t nMaxUsedCount;
+
+  /**
+   * Specifies the number of allocations failed because the pool was empty.
+   */
+  uint32_t nFailedCount;
+};
+
+/**
+ * Create a type name for _SysMemPool.
+ */
+typedef struct _SysMemPool SysMemPool;
+
+/**
+ * Internal state of a pool. Use ::SYS_MEM_POOL_DEFINE to define an object of this type.
+ */
+struct _SysMemPool {
+  /**
+   * Specifies the first block of the pool.
+   */
+  uint8_t *m_pnBlocks;
+
+  /**
+   * Specifies the first free block. Each free block stores the address of the next free block.
+   */
+  void *m_pvFreeList;
+
+  /**
+   * Usage statistics of the pool.
+   */
+  SysMemPoolStats m_xStats;
+};
+
+
+// Public API declaration
+//***********************
+
+/**
+ * Initialize a pool. All the blocks are free.
+ *
+ * @param _this [IN] specifies a pool object.
+ * @param pvBuffer [IN] specifies the storage of the pool. It must be aligned to 8 bytes and its size must be
+ *        nBlockCount * nBlockSize bytes.
+ * @param nBlockSize [IN] specifies the size in byte of a block. It must be computed with ::SYS_MEM_POOL_BLOCK_SIZE.
+ * @param nBlockCount [IN] specifies the number of blocks.
+ * @return SYS_NO_ERROR_CODE if success, SYS_INVALID_PARAMETER_ERROR_CODE otherwise.
+ */
+sys_error_code_t SysMemPoolInit(SysMemPool *_this, void *pvBuffer, size_t nBlockSize, uint16_t nBlockCount);
+
+/**
+ * Allocate a block from the pool. The content of the block is not initialized.
+ *
+ * @param _this [IN] specifies a pool object.
+ * @return a pointer to a block, or NULL if the pool is empty.
+ */
+void *SysMemPoolAlloc(SysMemPool *_this);
+
+/**
+ * Release a block allocated with SysMemPoolAlloc().
+ *
+ * @param _this [IN] specifies a pool object.
+ * @param pvBlock [IN] specifies a block of the pool.
+ * @return SYS_NO_ERROR_CODE if success, SYS_INVALID_PARAMETER_ERROR_CODE if pvBlock is not the start of a block
+ *         of the pool, or if the block is already free (only if ::SYS_MEM_POOL_CFG_CHECK_OWNERSHIP is 1).
+ */
+sys_error_code_t SysMemPoolFree(SysMemPool *_this, void *pvBlock);
+
+/**
+ * Get the index of a block in the storage of a pool.
+ *
+ * @param _this [IN] specifies a pool object.
+ * @param pvBlock [IN] specifies a block of the pool.
+ * @return the index of the block, or the number of blocks of the pool if pvBlock is not the start of a block of the pool.
+ */
+uint16_t SysMemPoolGetBlockIndex(SysMemPool *_this, const void *pvBlock);
+
+/**
+ * Get a block from its index in the storage of a pool.
+ *
+ * @param _this [IN] specifies a pool object.
+ * @param nIndex [IN] specifies the index of the block.
+ * @return a pointer to the block, or NULL if the index is not valid.
+ */
+void *SysMemPoolGetBlock(SysMemPool *_this, uint16_t nIndex);
+
+/**
+ * Check if a memory address belongs to the storage of a pool.
+ *
+ * @param _this [IN] specifies a pool object.
+ * @param pvBlock [IN] specifies a memory address.
+ * @return `TRUE` if pvBlock is in the storage of the pool, `FALSE` otherwise.
+ */
+boolean_t SysMemPoolContains(SysMemPool *_this, const void *pvBlock);
+
+/**
+ * Get the usage statistics of a pool.
+ *
+ * @param _this [IN] specifies a pool object.
+ * @return a copy of the statistics.
+ */
+SysMemPoolStats SysMemPoolGetStats(SysMemPool *_this);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_SYSMEMPOOL_H_ */
@@ -0,0 +1,104 @@
+/**
+ ******************************************************************************
+ * @file    SysTimestamp.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   High resolution timestamp used by the profilers of the framework.
+ *
+ * The timestamp is the DWT cycle counter of the core, so it is available only on the Cortex-M3 and above.
+ * The counter is started by the first call of SysTsGetTimestamp(). A duration is a difference of two
+ * timestamps, and it is correct also if the counter wraps around between the two timestamps.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_SYSTIMESTAMP_H_
+#define INCLUDE_SERVICES_SYSTIMESTAMP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "systp.h"
+#include "systypes.h"
+
+
+/* Public API declaration */
+/**************************/
+
+/**
+ * Get the current timestamp. The first call starts the DWT cycle counter.
+ *
+ * @return the current value of the DWT cycle counter.
+ */
+static inline uint32_t SysTsGetTimestamp(void);
+
+/**
+ * Get the time elapsed from a timestamp. The duration is computed with the current core clock, so the
+ * duration of an interval that spans a clock change is an approximation.
+ *
+ * @param nStart [IN] specifies a timestamp.
+ * @return the time, in us, elapsed from nStart.
+ */
+static inline uint32_t SysTsGetElapsedUs(uint32_t nStart);
+
+/**
+ * Convert a number of cycles of the core in us, with the current core clock.
+ *
+ * @param nCycles [IN] specifies a number of cycles.
+ * @return the duration in us.
+ */
+static inline uint32_t SysTsCyclesToUs(uint32_t nCycles);
+
+
+/* Inline functions definition */
+/*******************************/
+
+static inline uint32_t SysTsGetTimestamp(void) {
+  if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+
+  return DWT->CYCCNT;
+}
+
+static inline uint32_t SysTsGetElapsedUs(uint32_t nStart) {
+  return SysTsCyclesToUs(SysTsGetTimestamp() - nStart);
+}
+
+static inline uint32_t SysTsCyclesToUs(uint32_t nCycles) {
+  uint32_t nCyclesPerUs = SystemCoreClock / 1000000U;
+  uint32_t nElapsed;
+
+  if (nCyclesPerUs != 0U) {
+    nElapsed = nCycles / nCyclesPerUs;
+  }
+  else if (SystemCoreClock != 0U) {
+    /* the core clock is below 1 MHz (e.g. MSI at 100 kHz in low power run).*/
+    nElapsed = (uint32_t)(((uint64_t)nCycles * 1000000U) / SystemCoreClock);
+  }
+  else {
+    nElapsed = 0U;
+  }
+
+  return nElapsed;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_SYSTIMESTAMP_H_ */
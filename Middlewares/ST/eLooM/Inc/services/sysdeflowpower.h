@@ -49,6 +49,11 @@ typedef enum {
    * an IRQ in order to wake the system up.
    */
   E_POWER_MODE_SLEEP_1 = 1,
+
+  /**
+   * This value is used by the framework to identify the numbers of states.
+   */
+  E_POWER_MODE_NONE = 2,
 }EPowerMode;
 
 /**
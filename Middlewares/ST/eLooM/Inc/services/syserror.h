@@ -47,6 +47,15 @@ typedef uint16_t sys_error_code_t;
 #define SYS_ERR_EVT_PARAM_EFT_TIMEOUT       0x3U  ///< Event parameter: EFT error timeout.
 #define SYS_ERR_EVT_PARAM_NOP               0x4U  ///< Event parameter: EFT IRQ to be ignored.
 
+#define SYS_ERR_EVT_SRC_INIT                0x2U  ///< Event generated from the INIT task.
+// INIT task parameters
+#define SYS_ERR_EVT_PARAM_PM_DEADLINE       0x1U  ///< Event parameter: a task missed the deadline of a PM transaction.
+#define SYS_ERR_EVT_PARAM_PM_DEPENDENCY     0x2U  ///< Event parameter: a PM dependency has been ignored in a PM transaction.
+
+#define SYS_ERR_EVT_SRC_STACK_GUARD         0x3U  ///< Event generated from the stack guard.
+// Stack guard parameters
+#define SYS_ERR_EVT_PARAM_STACK_OVERFLOW    0x1U  ///< Event parameter: a task overflowed its stack.
+
 /**
  * Macro to make system error event.
  *
@@ -180,6 +189,7 @@ void sys_error_handler(void);
 // ApplicationContext error
 #define SYS_BASE_AC_ERROR_CODE                                SYS_BASE_ERROR_CODE + SYS_GROUP_ERROR_COUNT
 #define SYS_AC_TASK_ALREADY_ADDED_ERROR_CODE                  SYS_BASE_AC_ERROR_CODE + 1
+#define SYS_AC_TASK_NOT_FOUND_ERROR_CODE                      SYS_BASE_AC_ERROR_CODE + 2
 
 
 /* Task Level Service error code */
@@ -196,8 +206,11 @@ void sys_error_handler(void);
 #define SYS_BASE_INIT_TASK_ERROR_CODE                         SYS_BASE_TASK_ERROR_CODE + SYS_GROUP_ERROR_COUNT
 #define SYS_INIT_TASK_FAILURE_ERROR_CODE                      SYS_BASE_INIT_TASK_ERROR_CODE + 1
 #define SYS_INIT_TASK_POWER_MODE_NOT_ENABLE_ERROR_CODE        SYS_BASE_INIT_TASK_ERROR_CODE + 2
+#define SYS_INIT_TASK_PM_DEPENDENCY_ERROR_CODE                SYS_BASE_INIT_TASK_ERROR_CODE + 3
+#define SYS_INIT_TASK_ERROR_EVENT_LOST_ERROR_CODE             SYS_BASE_INIT_TASK_ERROR_CODE + 4
+#define SYS_INIT_TASK_HAS_PM_DEPENDENTS_ERROR_CODE            SYS_BASE_INIT_TASK_ERROR_CODE + 5
 
-#define SYS_LAST_ERROR_CODE                                   SYS_INIT_TASK_POWER_MODE_NOT_ENABLE_ERROR_CODE
+#define SYS_LAST_ERROR_CODE                                   SYS_INIT_TASK_HAS_PM_DEPENDENTS_ERROR_CODE
 
 #define APP_BASE_ERROR_CODE                                   SYS_LAST_ERROR_CODE + 1  ///<< Initial value for the application defined error codes.
 
@@ -0,0 +1,119 @@
+/**
+ ******************************************************************************
+ * @file    syseventpool.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Pool of the system event attachments.
+ *
+ * A ::SysEvent can carry a reference to a block of a fixed-block pool (see SysMemPool.h), the attachment,
+ * to give to INIT and to the IApplicationErrorDelegate the context of the event
+ * (for example the status of a peripheral read in the ISR). The event remains
+ * one word, and the attachment is consumed without copy.
+ *
+ * The ownership of the attachment follows the event:
+ * - the producer allocates a block with SysEvtPoolAlloc(), fills it and attaches it to the event with SysEvtAttach().
+ * - SysPostEvent() takes the ownership. If the event cannot be posted the attachment is released.
+ * - INIT releases the attachment when the event has been processed, so the consumer must not keep a reference
+ *   to the attachment after ::IAEDProcessEvent() or ::IapmhComputeNewPowerModeFrom() return.
+ *
+ * All the functions can be called also from an ISR.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_SYSEVENTPOOL_H_
+#define INCLUDE_SERVICES_SYSEVENTPOOL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "systp.h"
+#include "systypes.h"
+#include "syserror.h"
+#include "events/sysevent.h"
+
+
+#ifndef SYS_EVT_POOL_CFG_BLOCK_COUNT
+#define SYS_EVT_POOL_CFG_BLOCK_COUNT          8U
+#endif
+
+#ifndef SYS_EVT_POOL_CFG_BLOCK_SIZE
+#define SYS_EVT_POOL_CFG_BLOCK_SIZE           32U
+#endif
+
+#if (SYS_EVT_POOL_CFG_BLOCK_COUNT > 31U)
+#error SYS_EVT_POOL_CFG_BLOCK_COUNT must be in [0, 31] (see SysEvent::nAttachment)
+#endif
+
+
+// Public API declaration
+//***********************
+
+/**
+ * Initialize the pool. All the blocks are free. It is called by the system before the scheduler starts.
+ */
+void SysEvtPoolInit(void);
+
+/**
+ * Allocate a block from the pool. The content of the block is not initialized.
+ *
+ * @return a pointer to a block of ::SYS_EVT_POOL_CFG_BLOCK_SIZE bytes, or NULL if the pool is empty.
+ */
+void *SysEvtPoolAlloc(void);
+
+/**
+ * Release a block allocated with SysEvtPoolAlloc() and not attached to an event.
+ *
+ * @param pvBlock [IN] specifies a block.
+ */
+void SysEvtPoolFree(void *pvBlock);
+
+/**
+ * Attach a block to an event.
+ *
+ * @param pxEvent [IN] specifies an event.
+ * @param pvBlock [IN] specifies a block allocated with SysEvtPoolAlloc().
+ * @return SYS_NO_ERROR_CODE if success, SYS_INVALID_PARAMETER_ERROR_CODE if pvBlock is not a block of the pool.
+ */
+sys_error_code_t SysEvtAttach(SysEvent *pxEvent, void *pvBlock);
+
+/**
+ * Get the attachment of an event.
+ *
+ * @param xEvent [IN] specifies an event.
+ * @return a pointer to the attachment, or NULL if the event has no attachment.
+ */
+const void *SysEvtGetAttachment(const SysEvent xEvent);
+
+/**
+ * Release the attachment, if any, of an event. It is used by the framework when the event has been consumed.
+ *
+ * @param xEvent [IN] specifies an event.
+ */
+void SysEvtRelease(const SysEvent xEvent);
+
+/**
+ * Get the number of free blocks in the pool.
+ *
+ * @return the number of free blocks in the pool.
+ */
+uint8_t SysEvtPoolGetFreeCount(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_SYSEVENTPOOL_H_ */
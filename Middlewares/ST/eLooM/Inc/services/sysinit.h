@@ -15,6 +15,10 @@
  * \image html 2_system_init_diagram.png "Fig.2 - System initialization diagram"
  * For each managed task ...
  *
+ * The managed tasks wake up INIT with its FreeRTOS task notification, so the port requires
+ * configUSE_TASK_NOTIFICATIONS = 1 in FreeRTOSConfig.h. INIT resumes a managed task with a binary semaphore
+ * owned by the task (see AMTResume()), so the notification of a managed task is left to the application.
+ *
  ******************************************************************************
  * @attention
  *
@@ -37,12 +41,115 @@
 #include "IAppPowerModeHelper_vtbl.h"
 #include "IBoot.h"
 #include "IBootVtbl.h"
+#include "syseventpool.h"
+#include "sysmanifest.h"
+#include "sysmem.h"
 
 #ifdef __cplusplus
  extern "C" {
 #endif
 
-#if( configAPPLICATION_ALLOCATED_HEAP == 1 )
+/**
+ * Number of system event lanes. See ::ESysEventLane.
+ */
+#define SYS_EVT_LANE_COUNT                      2U
+
+/**
+ * The system events are serialized in two lanes. INIT always serves the error lane first.
+ */
+typedef enum _ESysEventLane {
+  E_SYS_EVT_LANE_ERROR = 0,   ///< Lane of the error events.
+  E_SYS_EVT_LANE_PM    = 1    ///< Lane of the power mode events.
+} ESysEventLane;
+
+/**
+ * Statistics of a system event lane. They allow to size the lanes at the end of the development.
+ */
+typedef struct _SysEventLaneStats {
+  /**
+   * Specifies the number of events that the lane can store.
+   */
+  uint16_t nDepth;
+
+  /**
+   * Specifies the maximum number of events pending in the lane.
+   */
+  uint16_t nHighWaterMark;
+
+  /**
+   * Specifies the number of events lost because the lane was full.
+   */
+  uint32_t nLostEvents;
+} SysEventLaneStats;
+
+/**
+ * Attachment of the error event (::SYS_ERR_EVT_SRC_INIT, ::SYS_ERR_EVT_PARAM_PM_DEADLINE) posted by INIT
+ * when a managed task misses the deadline of a power mode transaction (see SysSetPowerModeSwitchDeadline()).
+ * If the event pool is empty the event is posted without attachment.
+ */
+typedef struct _SysPMDeadlineMiss {
+  /**
+   * Specifies the task that missed the deadline.
+   */
+  AManagedTask *pxTask;
+
+  /**
+   * Specifies the active power mode of the transaction.
+   */
+  EPowerMode eActivePowerMode;
+
+  /**
+   * Specifies the new power mode of the transaction.
+   */
+  EPowerMode eNewPowerMode;
+
+  /**
+   * `TRUE` if the list of the late tasks is full, so the task skipped the transaction: it did not enter
+   * the new power mode and it keeps running. `FALSE` if the task completes its power mode switch as soon as it is ready.
+   */
+  boolean_t bIsSkipped;
+} SysPMDeadlineMiss;
+
+/**
+ * Attachment of the error event (::SYS_ERR_EVT_SRC_INIT, ::SYS_ERR_EVT_PARAM_PM_DEPENDENCY) posted by INIT
+ * when a PM dependency (see AMTExSetPMDependencies()) cannot be satisfied in a power mode transaction, because
+ * it is part of a cycle or because the dependency belongs to a higher PM class. INIT ignores only this dependency
+ * for the rest of the transaction. If the event pool is empty the event is posted without attachment.
+ */
+typedef struct _SysPMDependencyBreak {
+  /**
+   * Specifies the dependent task.
+   */
+  AManagedTask *pxTask;
+
+  /**
+   * Specifies the dependency that has been ignored.
+   */
+  AManagedTask *pxDependency;
+
+  /**
+   * Specifies the active power mode of the transaction.
+   */
+  EPowerMode eActivePowerMode;
+
+  /**
+   * Specifies the new power mode of the transaction.
+   */
+  EPowerMode eNewPowerMode;
+} SysPMDependencyBreak;
+
+/**
+ * Function called by INIT when it has served a request to load or to unload a managed task
+ * (see SysLoadTask() and SysUnloadTask()). It is executed by INIT, so it must not block.
+ * After an unload the task object is not used anymore by the system, so the function can release it together
+ * with the driver objects allocated by the task.
+ *
+ * @param pxTask [IN] specifies the task of the request.
+ * @param xRes [IN] specifies SYS_NO_ERROR_CODE if the request has been served, an error code otherwise.
+ */
+typedef void (*pSysTaskRequestDoneFunc_t)(AManagedTask *pxTask, sys_error_code_t xRes);
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1) && (configAPPLICATION_ALLOCATED_HEAP == 1)
 /**
  * The FreeRTOS HEAP is allocated by the application so the system can initialize the heap memory at startup
  * in order to prevent some SRAM retention strange issue.
@@ -81,6 +188,7 @@ void SysPostSleepProcessing(uint32_t * ulExpectedIdleTime);
 /**
  * This function is used by the system in order to add all the managed tasks to the application context.
  * It is defined as weak in order to allow the user application to redefine it.
+ * It is not used if the application defines a manifest (see SysGetAppManifest()).
  *
  * @param pAppContext [IN] specifies a pointer to the application context to load with the application specific managed tasks.
  * @return SYS_NO_ERROR_CODE if success, an error code otherwise.
@@ -106,13 +214,89 @@ sys_error_code_t SysOnStartApplication(ApplicationContext *pAppContext);
  */
 sys_error_code_t SysTaskErrorHandler(AManagedTask *pxTask);
 
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+/**
+ * Request INIT to load a managed task at runtime. INIT adds the task to the application context,
+ * initializes its hardware resources and creates the native task, as it does at startup for the tasks
+ * added in SysLoadApplicationContext(). The task starts in the active power mode.
+ * The request is served by INIT after the pending system events.
+ *
+ * @param pxTask [IN] specifies a task object. It must not be in the application context.
+ * @param pfDone [IN] specifies the function called by INIT when the request has been served. It can be NULL.
+ * @return SYS_NO_ERROR_CODE if the request has been posted, SYS_TASK_QUEUE_FULL_ERROR_CODE if the queue of the requests
+ *         is full, SYS_INVALID_FUNC_CALL_ERROR_CODE if the function is called from an ISR or before the system
+ *         is initialized.
+ */
+sys_error_code_t SysLoadTask(AManagedTask *pxTask, pSysTaskRequestDoneFunc_t pfDone);
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ * Request INIT to load a managed task at runtime, like SysLoadTask(), but the native task is created with
+ * `xTaskCreateStatic()` in the memory provided by the application (see ::SYS_APP_TASK_MEMORY). It is the only way
+ * to load a task in static allocation mode (`configSUPPORT_DYNAMIC_ALLOCATION = 0`). The memory can be reused
+ * after the task has been unloaded.
+ *
+ * @param pxTask [IN] specifies a task object. It must not be in the application context.
+ * @param pxStack [IN] specifies the stack of the task.
+ * @param pxTCB [IN] specifies the TCB of the task.
+ * @param nStackDepth [IN] specifies the depth, in word, of the stack. It replaces the stack depth given by the task.
+ * @param pfDone [IN] specifies the function called by INIT when the request has been served. It can be NULL.
+ * @return SYS_NO_ERROR_CODE if the request has been posted, SYS_INVALID_PARAMETER_ERROR_CODE if the task memory
+ *         is not valid, or the same error codes of SysLoadTask().
+ */
+sys_error_code_t SysLoadStaticTask(AManagedTask *pxTask, StackType_t *pxStack, StaticTask_t *pxTCB, uint16_t nStackDepth, pSysTaskRequestDoneFunc_t pfDone);
+#endif
+
+/**
+ * Request INIT to unload a managed task at runtime. INIT quiesces the task with the same handshake of a power mode
+ * transaction: the task completes its step and it waits to be resumed. Then INIT deletes the native task, so its stack and
+ * TCB return to the FreeRTOS heap (or to the application, if the task is static), and removes the task from the application context.
+ * The quiescence is bounded by the power mode switch deadline (see SysSetPowerModeSwitchDeadline()). If the task does
+ * not complete its step in time, it is not unloaded and pfDone is called with SYS_TIMEOUT_ERROR_CODE.
+ *
+ * A task can request its own unload. The application must remove the task from the PM dependencies of other tasks
+ * (see AMTExSetPMDependencies()), and stop the sources of deferred work (for example IRQs) that reference the task,
+ * before the request. If a task of the application context still depends on the task, the task is not unloaded and
+ * pfDone is called with SYS_INIT_TASK_HAS_PM_DEPENDENTS_ERROR_CODE.
+ *
+ * @param pxTask [IN] specifies a task object in the application context.
+ * @param pfDone [IN] specifies the function called by INIT when the request has been served. It can be NULL.
+ * @return SYS_NO_ERROR_CODE if the request has been posted, SYS_TASK_QUEUE_FULL_ERROR_CODE if the queue of the requests
+ *         is full, SYS_INVALID_FUNC_CALL_ERROR_CODE if the function is called from an ISR or before the system
+ *         is initialized.
+ */
+sys_error_code_t SysUnloadTask(AManagedTask *pxTask, pSysTaskRequestDoneFunc_t pfDone);
+
+/**
+ * Move a managed task of the application context in a new PM class. It is used by AMTExSetPMClass().
+ * INIT walks the PM class buckets during a power mode transaction, so it is the only one that moves a task:
+ * when the function is called by INIT the task is moved immediately, otherwise the request is posted to INIT and
+ * it is served after the running power mode transaction, if any.
+ *
+ * @param pxTask [IN] specifies a task object in the application context. It must be an ::_AManagedTaskEx.
+ * @param eNewPMClass [IN] specifies the new PM class.
+ * @return SYS_NO_ERROR_CODE if success, SYS_INVALID_PARAMETER_ERROR_CODE if the task is moved immediately and it
+ *         is not in the application context, or the same error codes of SysUnloadTask() if the request is posted.
+ */
+sys_error_code_t SysSetTaskPMClass(AManagedTask *pxTask, EPMClass eNewPMClass);
+
 /**
  * Check if there are pending ::SysEvent.
  *
- * @return `TRUE` if there are SysEvent pending (that means to be served by the INIT task), `FALSE` otherwise.
+ * @return `TRUE` if there are SysEvent, or requests to load or unload a task, pending (that means to be served
+ *         by the INIT task), `FALSE` otherwise.
  */
 boolean_t SysEventsPending(void);
 
+/**
+ * Get the statistics of a system event lane.
+ *
+ * @param eLane [IN] specifies a lane.
+ * @return a copy of the statistics of the lane.
+ */
+SysEventLaneStats SysGetEventLaneStats(ESysEventLane eLane);
+
 /**
  * Get the Application manager error delegate. This function is used by the system during the application startup
  * in order to get an application specific object that implements the ::IApplicationErrorDelegate. The default
@@ -91,6 +91,54 @@ EPowerMode SysGetPowerMode(void);
  */
 sys_error_code_t SysPostPowerModeEvent(SysEvent xEvent);
 
+/**
+ * Notify the system about an event related to the power mode management. If an event of the same source,
+ * posted with this function, is still waiting to be processed by the INIT task, then it is replaced by xEvent.
+ * In this way a burst of events of the same source uses at most one item of the system queue.
+ * This function can be called also from an ISR.
+ *
+ * @param xEvent [IN] specifies a power mode event.
+ * @return SYS_NO_ERROR_CODE if the event has been posted in the system queue with success, or if it replaced
+ *         a pending event, an error code otherwise.
+ */
+sys_error_code_t SysPostPowerModeEventReplace(SysEvent xEvent);
+
+/**
+ * Used by a managed task to notify the INIT task that it is ready for a pending power mode switch,
+ * that is it has just reset the `nDelayPowerModeSwitch` flag. INIT is blocked waiting for this
+ * notification instead of polling the status of the tasks.
+ * This function must be called from a task context.
+ */
+void SysNotifyPowerModeSwitchReady(void);
+
+/**
+ * Get the duration of the last power mode transaction. It is the time spent by INIT
+ * to bring all managed tasks in the new power mode, before the system enters the new power mode.
+ *
+ * @return the duration, in RTOS ticks, of the last power mode transaction.
+ */
+uint32_t SysGetPowerModeSwitchLatency(void);
+
+/**
+ * Get the number of times a managed task skipped a power mode transaction because it missed the deadline
+ * when the list of the late tasks was full (see ::SysPMDeadlineMiss).
+ *
+ * @return the number of skipped power mode switches since the system started.
+ */
+uint32_t SysGetPowerModeSwitchSkipCount(void);
+
+/**
+ * Set the deadline of the power mode transactions. INIT waits for the managed tasks that are not ready for the
+ * power mode switch at most until the deadline. The tasks that miss the deadline are reported to the
+ * IApplicationErrorDelegate (see ::SysPMDeadlineMiss) and the transaction continues without them.
+ * INIT checks the deadline every INIT_TASK_CFG_PM_SWITCH_DELAY_MS ms, so a task can be waited up to that delay
+ * beyond the deadline.
+ * The default value is INIT_TASK_CFG_PM_SWITCH_DEADLINE_MS.
+ *
+ * @param nDeadlineMs [IN] specifies the maximum duration, in ms, of a power mode transaction. Zero means no deadline.
+ */
+void SysSetPowerModeSwitchDeadline(uint32_t nDeadlineMs);
+
 /* Inline functions definition */
 /*******************************/
 
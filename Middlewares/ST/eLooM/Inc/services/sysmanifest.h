@@ -0,0 +1,175 @@
+/**
+ ******************************************************************************
+ * @file    sysmanifest.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Static application manifest.
+ *
+ * The application manifest is a const table, built at compile time, that lists the managed tasks of the application.
+ * It is an alternative to SysLoadApplicationContext(). When the application defines a manifest with
+ * ::SYS_APP_MANIFEST, INIT:
+ * - allocates the task objects and builds the ::ApplicationContext in the order of the manifest, without
+ *   the duplicate check of ACAddTask(). The manifest must list each task once.
+ * - creates the tasks declared with ::SYS_APP_STATIC_TASK with `xTaskCreateStatic()`, so their stacks and TCBs are
+ *   allocated by the linker and the FreeRTOS heap does not need to be sized for them.
+ *
+ * The order of the manifest is the order used by INIT to initialize the hardware, to create the tasks and
+ * to visit them during a power mode transaction.
+ *
+ * In static allocation mode (`configSUPPORT_DYNAMIC_ALLOCATION = 0`) all the tasks of the manifest must be declared
+ * with ::SYS_APP_STATIC_TASK, and the tasks loaded at runtime use SysLoadStaticTask().
+ *
+ * ~~~{.c}
+ * static AManagedTask *AppDWQAlloc(const void *pvParams) {
+ *   UNUSED(pvParams);
+ *   return (AManagedTask*)DWQAlloc();
+ * }
+ *
+ * SYS_APP_TASK_MEMORY(HW, HW_TASK_CFG_STACK_DEPTH);
+ * SYS_APP_TASK_MEMORY(DWQ, DWQ_TASK_CFG_STACK_DEPTH);
+ *
+ * static const SysAppTaskEntry s_xAppManifest[] = {
+ *   SYS_APP_STATIC_TASK(HW, HelloWorldTaskAlloc, &MX_GPIO_PE0InitParams),
+ *   SYS_APP_STATIC_TASK(DWQ, AppDWQAlloc, NULL)
+ * };
+ *
+ * SYS_APP_MANIFEST(s_xAppManifest)
+ * ~~~
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_SYSMANIFEST_H_
+#define INCLUDE_SERVICES_SYSMANIFEST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "systp.h"
+#include "systypes.h"
+#include "AManagedTask.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+
+/**
+ * Specifies the allocator of a managed task listed in the manifest. It is the usual `Alloc` function of the task class.
+ *
+ * @param pvParams [IN] specifies the parameter of the entry.
+ * @return a pointer to the task object, or NULL if the task cannot be allocated.
+ */
+typedef AManagedTask *(*pSysTaskAllocFunc_t)(const void *pvParams);
+
+/**
+ * Create a type name for _SysAppTaskEntry.
+ */
+typedef struct _SysAppTaskEntry SysAppTaskEntry;
+
+/**
+ * An entry of the application manifest. Use ::SYS_APP_TASK and ::SYS_APP_STATIC_TASK to declare it.
+ */
+struct _SysAppTaskEntry {
+  /**
+   * Specifies the allocator of the task object.
+   */
+  pSysTaskAllocFunc_t pfAlloc;
+
+  /**
+   * Specifies the parameter passed to ::pfAlloc.
+   */
+  const void *pvParams;
+
+  /**
+   * Specifies the stack of the task, or NULL if the task is created with `xTaskCreate()`.
+   */
+  StackType_t *pxStack;
+
+  /**
+   * Specifies the TCB of the task, or NULL if the task is created with `xTaskCreate()`.
+   */
+  StaticTask_t *pxTCB;
+
+  /**
+   * Specifies the depth, in word, of ::pxStack. It replaces the stack depth given by the task in AMTOnCreateTask().
+   */
+  uint16_t nStackDepth;
+};
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+/**
+ * Declare an entry for a task created with `xTaskCreate()`.
+ *
+ * @param alloc [IN] specifies the allocator of the task object (see ::pSysTaskAllocFunc_t).
+ * @param params [IN] specifies the parameter of the allocator.
+ */
+#define SYS_APP_TASK(alloc, params)           { (alloc), (params), NULL, NULL, 0U }
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+
+/**
+ * Define the stack and the TCB of a task declared with ::SYS_APP_STATIC_TASK, or loaded with SysLoadStaticTask().
+ * It must be used at file scope.
+ *
+ * @param name [IN] specifies a name, unique in the file, for the task memory.
+ * @param depth [IN] specifies the stack depth in word.
+ */
+#define SYS_APP_TASK_MEMORY(name, depth) \
+  static StackType_t s_x##name##Stack[(depth)]; \
+  static StaticTask_t s_x##name##TCB
+
+/**
+ * Declare an entry for a task created with `xTaskCreateStatic()`, using the memory defined with ::SYS_APP_TASK_MEMORY.
+ *
+ * @param name [IN] specifies the name of the task memory.
+ * @param alloc [IN] specifies the allocator of the task object (see ::pSysTaskAllocFunc_t).
+ * @param params [IN] specifies the parameter of the allocator.
+ */
+#define SYS_APP_STATIC_TASK(name, alloc, params) \
+  { (alloc), (params), s_x##name##Stack, &s_x##name##TCB, (uint16_t)(sizeof(s_x##name##Stack) / sizeof(StackType_t)) }
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+/**
+ * Define the manifest of the application. It implements SysGetAppManifest().
+ *
+ * @param table [IN] specifies a const array of ::SysAppTaskEntry.
+ */
+#define SYS_APP_MANIFEST(table) \
+  const SysAppTaskEntry *SysGetAppManifest(uint8_t *pnTaskCount) { \
+    *pnTaskCount = (uint8_t)(sizeof(table) / sizeof((table)[0])); \
+    return (table); \
+  }
+
+
+// Public API declaration
+//***********************
+
+/**
+ * Get the manifest of the application. It is used by INIT before SysLoadApplicationContext(): if the application
+ * has a manifest, INIT loads the application context from the manifest and SysLoadApplicationContext() is not called.
+ * The default implementation is defined as \a weak and it returns NULL. Use ::SYS_APP_MANIFEST to redefine it.
+ *
+ * @param pnTaskCount [OUT] specifies the number of entries of the manifest.
+ * @return a pointer to the first entry of the manifest, or NULL if the application has no manifest.
+ */
+const SysAppTaskEntry *SysGetAppManifest(uint8_t *pnTaskCount);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_SYSMANIFEST_H_ */
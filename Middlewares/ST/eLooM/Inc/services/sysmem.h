@@ -0,0 +1,162 @@
+/**
+ ******************************************************************************
+ * @file    sysmem.h
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   System memory allocator.
+ *
+ * The `Alloc` functions of the framework and of the application objects allocate the memory with SysAlloc() and
+ * release it with SysFree(). The default implementation uses a set of fixed-block pools (see SysMemPool.h), one
+ * for each size class listed in the X-macro SYS_MEM_CFG_POOLS(X) of the sysconfig.h file:
+ *
+ * ~~~{.c}
+ * // X(block size, block count). The size classes must be in ascending order.
+ * #define SYS_MEM_CFG_POOLS(X)  X(16U, 4U) X(32U, 4U) X(64U, 2U)
+ * ~~~
+ *
+ * An object is allocated from the smallest size class that fits it and has a free block, so the allocation time
+ * does not depend on the fragmentation of the memory. If all these size classes are empty, or no size class fits
+ * the object, the object is allocated in the FreeRTOS heap (only from a task, and if
+ * `configSUPPORT_DYNAMIC_ALLOCATION = 1`). SysMemGetPoolStats() gives the high-water mark of each size class.
+ * If SYS_MEM_CFG_POOLS is not defined, SysAlloc() and SysFree() are the FreeRTOS `pvPortMalloc()` and `vPortFree()`.
+ *
+ * The memory left free by the linker in the SRAM banks can be added as heap regions with the X-macro
+ * SYS_MEM_CFG_REGIONS(X) of the sysconfig.h file. Each region is managed by its own heap (see SysMemHeap.h),
+ * and it is delimited by two symbols of the linker script:
+ *
+ * ~~~{.c}
+ * // X(start symbol, end symbol, placement)
+ * #define SYS_MEM_CFG_REGIONS(X)  X(_sram2_heap_start, _sram2_heap_end, E_SYS_MEM_FAST) \
+ *                                 X(_sram3_heap_start, _sram3_heap_end, E_SYS_MEM_BULK)
+ * ~~~
+ *
+ * SysAllocEx() allocates a block in a region with a given placement: the objects used often, and the buffers shared
+ * with an ISR, should be placed in the zero-wait state memory (::E_SYS_MEM_FAST), and the large data buffers in the
+ * bulk memory (::E_SYS_MEM_BULK). If no region with that placement can serve the request, the block is allocated with
+ * SysAlloc(). SysAlloc() uses the regions, in the order they are listed, only after the pools and the FreeRTOS heap.
+ * SysMemGetRegionStats() gives the usage statistics of each region.
+ *
+ * SysAlloc(), SysAllocEx() and SysFree() are defined as \a weak, so the application can plug its own allocator.
+ * The default SysAllocEx() allocates also from the heap regions, so an application that replaces SysFree() must
+ * replace SysAllocEx() too.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+#ifndef INCLUDE_SERVICES_SYSMEM_H_
+#define INCLUDE_SERVICES_SYSMEM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "systp.h"
+#include "systypes.h"
+#include "syserror.h"
+#include "SysMemPool.h"
+#include "SysMemHeap.h"
+
+
+/**
+ * Specifies where a memory block should be placed. It is used as placement of the heap regions listed in
+ * SYS_MEM_CFG_REGIONS, and as hint for SysAllocEx().
+ */
+typedef enum _ESysMemPlacement {
+  E_SYS_MEM_ANY = 0, /**< no preference. */
+  E_SYS_MEM_FAST,    /**< zero-wait state memory, for the objects used often and the buffers shared with an ISR. */
+  E_SYS_MEM_BULK     /**< large memory, for the data buffers. */
+} ESysMemPlacement;
+
+
+// Public API declaration
+//***********************
+
+/**
+ * Initialize the system memory allocator. It is called by the system before the scheduler starts,
+ * so the objects can be allocated also from SysInit().
+ */
+void SysMemInit(void);
+
+/**
+ * Allocate a memory block. It can be called also from an ISR, if the block is allocated from a pool.
+ *
+ * @param nSize [IN] specifies the size in byte of the block.
+ * @return a pointer to the block, or NULL if out of memory.
+ */
+void *SysAlloc(size_t nSize);
+
+/**
+ * Allocate a memory block in a heap region with a given placement. If no region can serve the request,
+ * or if the function is called from an ISR, the block is allocated with SysAlloc().
+ *
+ * @param nSize [IN] specifies the size in byte of the block.
+ * @param ePlacement [IN] specifies where the block should be placed.
+ * @return a pointer to the block, or NULL if out of memory.
+ */
+void *SysAllocEx(size_t nSize, ESysMemPlacement ePlacement);
+
+/**
+ * Release a memory block allocated with SysAlloc() or SysAllocEx(). It can be called also from an ISR, if the block
+ * has been allocated from a pool. A block of the FreeRTOS heap or of a heap region is not released when the function
+ * is called from an ISR: the error is reported with SYS_INVALID_FUNC_CALL_ERROR_CODE.
+ *
+ * @param pvData [IN] specifies the block. It can be NULL.
+ */
+void SysFree(void *pvData);
+
+/**
+ * Get the number of pools of the system memory allocator.
+ *
+ * @return the number of size classes listed in SYS_MEM_CFG_POOLS, or zero.
+ */
+uint8_t SysMemGetPoolCount(void);
+
+/**
+ * Get the usage statistics of a pool of the system memory allocator.
+ *
+ * @param nPool [IN] specifies the index of the pool in SYS_MEM_CFG_POOLS.
+ * @param pxStats [OUT] specifies the statistics of the pool.
+ * @return SYS_NO_ERROR_CODE if success, SYS_INVALID_PARAMETER_ERROR_CODE if nPool is not valid.
+ */
+sys_error_code_t SysMemGetPoolStats(uint8_t nPool, SysMemPoolStats *pxStats);
+
+/**
+ * Get the number of blocks allocated in the FreeRTOS heap because no pool could serve the request.
+ *
+ * @return the number of blocks allocated in the FreeRTOS heap.
+ */
+uint32_t SysMemGetHeapFallbackCount(void);
+
+/**
+ * Get the number of heap regions of the system memory allocator.
+ *
+ * @return the number of regions listed in SYS_MEM_CFG_REGIONS, or zero.
+ */
+uint8_t SysMemGetRegionCount(void);
+
+/**
+ * Get the usage statistics of a heap region of the system memory allocator.
+ *
+ * @param nRegion [IN] specifies the index of the region in SYS_MEM_CFG_REGIONS.
+ * @param pxStats [OUT] specifies the statistics of the region.
+ * @return SYS_NO_ERROR_CODE if success, SYS_INVALID_PARAMETER_ERROR_CODE if nRegion is not valid.
+ */
+sys_error_code_t SysMemGetRegionStats(uint8_t nRegion, SysMemHeapStats *pxStats);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SERVICES_SYSMEM_H_ */
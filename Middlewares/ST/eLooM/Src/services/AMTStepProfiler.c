@@ -0,0 +1,238 @@
+/**
+ ******************************************************************************
+ * @file    AMTStepProfiler.c
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief
+ *
+ * <DESCRIPTIOM>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+
+#include "services/AMTStepProfiler.h"
+#include "services/SysTimestamp.h"
+
+#if (AMT_CFG_ENABLE_STEP_PROFILER == 1)
+
+#include <string.h>
+
+_Static_assert(AMTSP_CFG_MAX_PM_STATES >= (uint32_t)E_POWER_MODE_NONE,
+    "AMTSP_CFG_MAX_PM_STATES is smaller than the number of PM states of the application");
+
+
+/**
+ * Specifies the profile of the running task, if it is executing a step.
+ */
+static AMTStepProfile *volatile s_pxRunningProfile = NULL;
+
+/**
+ * Specifies the list of the profiles whose step has been interrupted by a context switch.
+ * It is used only in the context switch.
+ */
+static AMTStepProfile *s_pxSwitchedOutProfiles = NULL;
+
+
+/* Private member function declaration */
+/***************************************/
+
+/**
+ * Clear the statistics of a profile.
+ *
+ * @param pxProfile [IN] specifies a profile.
+ */
+static void AMTSPClearProfile(AMTStepProfile *pxProfile);
+
+
+/* Public API definition */
+/*************************/
+
+sys_error_code_t AMTSPAttach(AManagedTask *pxTask, AMTStepProfile *pxProfile, const uint32_t *pnPMState2BudgetMap) {
+  assert_param(pxTask != NULL);
+  assert_param(pxProfile != NULL);
+
+  pxProfile->pnPMState2BudgetMap = pnPMState2BudgetMap;
+  pxProfile->pxTask = pxTask;
+  pxProfile->pxNextSwitchedOut = NULL;
+  pxProfile->nSeq = 0;
+  pxProfile->nResetPending = 0;
+  AMTSPClearProfile(pxProfile);
+  pxTask->m_pxStepProfile = pxProfile;
+
+  return SYS_NO_ERROR_CODE;
+}
+
+void AMTSPStepBegin(AManagedTask *pxTask) {
+  AMTStepProfile *pxProfile = pxTask->m_pxStepProfile;
+
+  if (pxProfile != NULL) {
+    pxProfile->nStepCycles = 0;
+    pxProfile->nStepStart = SysTsGetTimestamp();
+    /* from now on a context switch pauses the measure.*/
+    s_pxRunningProfile = pxProfile;
+  }
+}
+
+void AMTSPStepEnd(AManagedTask *pxTask, uint8_t nPMState) {
+  AMTStepProfile *pxProfile = pxTask->m_pxStepProfile;
+  AMTStepStats *pxStats;
+  uint32_t nDuration;
+  uint32_t nValue;
+  uint8_t nBin = 0;
+
+  if (pxProfile != NULL) {
+    /* stop the measure before reading the timestamp, so a context switch does not touch the profile anymore.*/
+    s_pxRunningProfile = NULL;
+  }
+
+  if ((pxProfile != NULL) && (nPMState < AMTSP_CFG_MAX_PM_STATES)) {
+    nDuration = SysTsCyclesToUs(pxProfile->nStepCycles + (SysTsGetTimestamp() - pxProfile->nStepStart));
+
+    /* the bin n counts the steps in [2^(n-1), 2^n) us.*/
+    nValue = nDuration;
+    while ((nValue != 0U) && (nBin < (AMTSP_CFG_HISTOGRAM_BINS - 1U))) {
+      nValue >>= 1;
+      nBin++;
+    }
+
+    pxStats = &pxProfile->xStats[nPMState];
+    /* only the task updates its statistics, so the readers are synchronized with the sequence number.*/
+    pxProfile->nSeq++;
+    __DMB();
+    if (pxProfile->nResetPending != 0U) {
+      AMTSPClearProfile(pxProfile);
+      pxProfile->nResetPending = 0;
+    }
+    if (pxStats->nCount == 0U) {
+      pxStats->nMin = nDuration;
+      pxStats->nMax = nDuration;
+    }
+    else if (nDuration < pxStats->nMin) {
+      pxStats->nMin = nDuration;
+    }
+    else if (nDuration > pxStats->nMax) {
+      pxStats->nMax = nDuration;
+    }
+    pxStats->nCount++;
+    pxStats->nSum += nDuration;
+    pxStats->nHistogram[nBin]++;
+    if ((pxProfile->pnPMState2BudgetMap != NULL) && (pxProfile->pnPMState2BudgetMap[nPMState] != 0U)
+        && (nDuration > pxProfile->pnPMState2BudgetMap[nPMState])) {
+      pxStats->nOverBudgetCount++;
+    }
+    __DMB();
+    pxProfile->nSeq++;
+  }
+}
+
+void AMTSPOnTaskSwitchedIn(const void *pvTCB) {
+  AMTStepProfile **ppxProfile = &s_pxSwitchedOutProfiles;
+
+  while ((*ppxProfile != NULL) && ((const void*)(*ppxProfile)->pxTask->m_xTaskHandle != pvTCB)) {
+    ppxProfile = &(*ppxProfile)->pxNextSwitchedOut;
+  }
+
+  if (*ppxProfile != NULL) {
+    /* the task resumes the execution of its step.*/
+    (*ppxProfile)->nStepStart = SysTsGetTimestamp();
+    s_pxRunningProfile = *ppxProfile;
+    *ppxProfile = (*ppxProfile)->pxNextSwitchedOut;
+  }
+}
+
+void AMTSPOnTaskSwitchedOut(void) {
+  AMTStepProfile *pxProfile = s_pxRunningProfile;
+
+  if (pxProfile != NULL) {
+    pxProfile->nStepCycles += SysTsGetTimestamp() - pxProfile->nStepStart;
+    pxProfile->pxNextSwitchedOut = s_pxSwitchedOutProfiles;
+    s_pxSwitchedOutProfiles = pxProfile;
+    s_pxRunningProfile = NULL;
+  }
+}
+
+sys_error_code_t AMTSPGetStats(AManagedTask *pxTask, EPowerMode ePowerMode, AMTStepStats *pxStats) {
+  assert_param(pxTask != NULL);
+  assert_param(pxStats != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  uint32_t nSeq;
+
+  if ((pxTask->m_pxStepProfile == NULL) || ((uint8_t)ePowerMode >= AMTSP_CFG_MAX_PM_STATES)) {
+    xRes = SYS_INVALID_PARAMETER_ERROR_CODE;
+  }
+  else {
+    /* retry the copy if the task updated the statistics in the meantime. The task can have a lower priority,
+     so the caller waits one tick instead of spinning while the update is in progress.*/
+    do {
+      nSeq = pxTask->m_pxStepProfile->nSeq;
+      if ((nSeq & 1U) != 0U) {
+        vTaskDelay(1);
+      }
+      else {
+        __DMB();
+        *pxStats = pxTask->m_pxStepProfile->xStats[(uint8_t)ePowerMode];
+        __DMB();
+      }
+    } while (((nSeq & 1U) != 0U) || (nSeq != pxTask->m_pxStepProfile->nSeq));
+  }
+
+  return xRes;
+}
+
+uint32_t AMTSPGetMean(const AMTStepStats *pxStats) {
+  assert_param(pxStats != NULL);
+
+  return pxStats->nCount != 0U ? (uint32_t)(pxStats->nSum / pxStats->nCount) : 0U;
+}
+
+uint32_t AMTSPGetPercentile(const AMTStepStats *pxStats, uint8_t nPercent) {
+  assert_param(pxStats != NULL);
+  assert_param((nPercent > 0U) && (nPercent <= 100U));
+  uint32_t nUpperBound = 0;
+  uint64_t nTarget = ((uint64_t)pxStats->nCount * nPercent + 99U) / 100U;
+  uint64_t nCumulative = 0;
+  uint8_t nBin = 0;
+
+  if (pxStats->nCount != 0U) {
+    for (nBin = 0; nBin < AMTSP_CFG_HISTOGRAM_BINS; ++nBin) {
+      nCumulative += pxStats->nHistogram[nBin];
+      if (nCumulative >= nTarget) {
+        break;
+      }
+    }
+    /* the bin n contains the durations in [2^(n-1), 2^n) us.*/
+    nUpperBound = (nBin < (AMTSP_CFG_HISTOGRAM_BINS - 1U)) ? (1UL << nBin) : UINT32_MAX;
+  }
+
+  return nUpperBound;
+}
+
+void AMTSPReset(AManagedTask *pxTask) {
+  assert_param(pxTask != NULL);
+
+  if (pxTask->m_pxStepProfile != NULL) {
+    /* the statistics are modified only by the task.*/
+    pxTask->m_pxStepProfile->nResetPending = 1;
+  }
+}
+
+
+/* Private function definition */
+/*******************************/
+
+static void AMTSPClearProfile(AMTStepProfile *pxProfile) {
+  (void)memset(pxProfile->xStats, 0, sizeof(pxProfile->xStats));
+}
+
+#endif /* AMT_CFG_ENABLE_STEP_PROFILER */
@@ -0,0 +1,43 @@
+/**
+ ******************************************************************************
+ * @file    AManagedActor.c
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief
+ *
+ * <DESCRIPTIOM>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+
+#include "services/AManagedActor.h"
+#include "services/AManagedActor_vtbl.h"
+
+
+/*
+ GCC requires one function forward declaration in only one .c source
+ in order to manage the inline.
+ See also http://stackoverflow.com/questions/26503235/c-inline-function-and-gcc
+*/
+#if defined (__GNUC__) || defined (__ICCARM__)
+extern sys_error_code_t AMAInit(AManagedActor *_this);
+extern sys_error_code_t AMAHardwareInit(AManagedActor *_this, void *pParams);
+extern sys_error_code_t AMADoEnterPowerMode(AManagedActor *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
+extern sys_error_code_t AMAHandleError(AManagedActor *_this, SysEvent xError);
+extern sys_error_code_t AMAOnEnterControlLoop(AManagedActor *_this);
+extern pActorStepFunc_t AMAGetStepFunc(AManagedActor *_this, EPowerMode ePowerMode);
+extern void AMAPost(AManagedActor *_this);
+extern void AMAPostFromISR(AManagedActor *_this, BaseType_t *pxHigherPriorityTaskWoken);
+extern uint8_t AMAGetErrorCount(AManagedActor *_this);
+#endif
@@ -22,6 +22,17 @@
 
 #include "services/AManagedTask.h"
 #include "services/AManagedTask_vtbl.h"
+#include "services/AMTStepProfiler.h"
+
+/**
+ * The Cortex-M3 and higher cores have the exclusive access instructions (LDREX/STREX) used to update the
+ * ::AMTStatus without a critical section. On the other cores the update is done in a critical section.
+ */
+#if defined(__CORTEX_M) && (__CORTEX_M >= 3U)
+#define AMT_STATUS_USE_EXCLUSIVE_ACCESS       1
+#else
+#define AMT_STATUS_USE_EXCLUSIVE_ACCESS       0
+#endif
 
 /* GCC requires one function forward declaration in only one .c source
  * in order to manage the inline.
@@ -39,14 +50,102 @@ extern void AMTResetAEDCounter(AManagedTask *this);
 extern EPowerMode AMTGetSystemPowerMode(void);
 extern EPowerMode AMTGetTaskPowerMode(AManagedTask *_this);
 extern boolean_t AMTIsPowerModeSwitchPending(AManagedTask *this);
+extern boolean_t AMTIsPowerModeSwitchRequired(AManagedTask *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
 extern void AMTReportErrOnStepExecution(AManagedTask *this, sys_error_code_t nStepError);
 extern sys_error_code_t AMTSetPMStateRemapFunc(AManagedTask *_this, EPowerMode *pPMState2PMStateMap);
+extern boolean_t AMTStatusCompareAndSwap(AManagedTask *_this, uint8_t nExpectedStatus, uint8_t nNewStatus);
+extern uint8_t AMTStatusModify(AManagedTask *_this, uint8_t nClearMask, uint8_t nSetMask);
+extern boolean_t AMTStatusTryDelayPowerModeSwitch(AManagedTask *_this);
+extern void AMTResume(AManagedTask *_this);
 #endif
 
 
 /* Public API definition */
 /*************************/
 
+boolean_t AMTStatusCompareAndSwap(AManagedTask *_this, uint8_t nExpectedStatus, uint8_t nNewStatus) {
+  assert_param(_this != NULL);
+  volatile uint8_t *pnStatus = &_this->m_xStatus.nRaw;
+  boolean_t bRes = FALSE;
+
+#if (AMT_STATUS_USE_EXCLUSIVE_ACCESS == 1)
+  if (__LDREXB(pnStatus) == nExpectedStatus) {
+    bRes = (__STREXB(nNewStatus, pnStatus) == 0U) ? TRUE : FALSE;
+  }
+  else {
+    __CLREX();
+  }
+#else
+  taskENTER_CRITICAL();
+  if (*pnStatus == nExpectedStatus) {
+    *pnStatus = nNewStatus;
+    bRes = TRUE;
+  }
+  taskEXIT_CRITICAL();
+#endif
+
+  return bRes;
+}
+
+#if (AMT_CFG_ENABLE_STATUS_BENCHMARK == 1)
+void AMTStatusBenchmark(AManagedTask *_this, uint32_t nIterations, uint32_t *pnCriticalSectionCycles, uint32_t *pnAtomicCycles) {
+  assert_param(_this != NULL);
+  assert_param(nIterations > 0U);
+  assert_param(pnCriticalSectionCycles != NULL);
+  assert_param(pnAtomicCycles != NULL);
+  uint32_t nStartCycles;
+  uint32_t i;
+
+  if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+
+  /* the step handshake before the lock-free status: one critical section to set the delay flag,
+   one critical section to clear it.*/
+  nStartCycles = DWT->CYCCNT;
+  for (i = 0; i < nIterations; ++i) {
+    taskENTER_CRITICAL();
+    _this->m_xStatus.nDelayPowerModeSwitch = 1;
+    taskEXIT_CRITICAL();
+    taskENTER_CRITICAL();
+    _this->m_xStatus.nDelayPowerModeSwitch = 0;
+    taskEXIT_CRITICAL();
+  }
+  *pnCriticalSectionCycles = (DWT->CYCCNT - nStartCycles) / nIterations;
+
+  /* the step handshake with the lock-free status.*/
+  nStartCycles = DWT->CYCCNT;
+  for (i = 0; i < nIterations; ++i) {
+    (void)AMTStatusTryDelayPowerModeSwitch(_this);
+    (void)AMTStatusModify(_this, AMT_STATUS_DELAY_PM_SWITCH_Msk, 0U);
+  }
+  *pnAtomicCycles = (DWT->CYCCNT - nStartCycles) / nIterations;
+}
+#endif
+
+void AMTWaitPowerModeSwitch(AManagedTask *_this) {
+  assert_param(_this != NULL);
+
+  (void)AMTStatusModify(_this, AMT_STATUS_DELAY_PM_SWITCH_Msk, 0U);
+  SysNotifyPowerModeSwitchReady();
+
+  /* INIT clears the pending flag at the end of the transaction, and then it gives the resume semaphore.
+   A resume left by a previous transaction wakes up the task too early, so the flag is checked again.*/
+  while (AMTIsPowerModeSwitchPending(_this)) {
+    (void)xSemaphoreTake(_this->m_xResumeSem, portMAX_DELAY);
+  }
+}
+
+void AMTWaitStepFunction(AManagedTask *_this) {
+  assert_param(_this != NULL);
+
+  while (!AMTIsPowerModeSwitchPending(_this) && (_this->m_pfPMState2FuncMap[(uint8_t)AMTGetTaskPowerMode(_this)] == NULL)) {
+    (void)xSemaphoreTake(_this->m_xResumeSem, portMAX_DELAY);
+  }
+}
+
 void AMTRun(void *pParams) {
   sys_error_code_t xRes;
   AManagedTask *_this = (AManagedTask*)pParams;
@@ -65,13 +164,12 @@ void AMTRun(void *pParams) {
       sys_error_handler();
     }
 
-    /* check if there is a pending power mode switch request */
-    if (_this->m_xStatus.nPowerModeSwitchPending == 1U) {
-      // clear the power mode switch delay because the task is ready to switch.
-      taskENTER_CRITICAL();
-      _this->m_xStatus.nDelayPowerModeSwitch = 0;
-      taskEXIT_CRITICAL();
-      vTaskSuspend(NULL);
+    /* check if there is a pending power mode switch request. If there is none, the power mode switch is delayed
+     until the end of the step. The check and the delay are a single atomic operation, so INIT cannot request
+     the switch in between.*/
+    if (!AMTStatusTryDelayPowerModeSwitch(_this)) {
+      /* the task is ready to switch: notify INIT and wait for the end of the transaction.*/
+      AMTWaitPowerModeSwitch(_this);
     }
     else {
       /* find the execute step function  */
@@ -79,17 +177,16 @@ void AMTRun(void *pParams) {
       pExecuteStepFunc = _this->m_pfPMState2FuncMap[nPMState];
 
       if (pExecuteStepFunc != NULL) {
-        taskENTER_CRITICAL();
-        _this->m_xStatus.nDelayPowerModeSwitch = 1;
-        taskEXIT_CRITICAL();
+        AMTSP_STEP_BEGIN(_this);
         xRes = pExecuteStepFunc(_this);
-        taskENTER_CRITICAL();
-        _this->m_xStatus.nDelayPowerModeSwitch = 0;
-        taskEXIT_CRITICAL();
+        AMTSP_STEP_END(_this, nPMState);
+        (void)AMTStatusModify(_this, AMT_STATUS_DELAY_PM_SWITCH_Msk, 0U);
       }
       else {
-        /* there is no function so, because this is a AManagedTask simply suspend it for a while */
-        vTaskDelay(pdMS_TO_TICKS(50));
+        /* there is no function so, the task waits until INIT resumes it after a power mode switch.
+         If a power mode switch is pending the task does the handshake in the next iteration.*/
+        (void)AMTStatusModify(_this, AMT_STATUS_DELAY_PM_SWITCH_Msk, 0U);
+        AMTWaitStepFunction(_this);
       }
 
       /* notify the system that the task is working fine. */
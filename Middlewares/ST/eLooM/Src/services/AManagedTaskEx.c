@@ -23,6 +23,7 @@
 
 #include "services/AManagedTaskEx.h"
 #include "services/AManagedTaskEx_vtbl.h"
+#include "services/AMTStepProfiler.h"
 
 
 /*
@@ -38,6 +39,8 @@ extern boolean_t AMTExIsTaskInactive(AManagedTaskEx *this);
 extern sys_error_code_t AMTExOnEnterPowerMode(AManagedTaskEx *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
 extern sys_error_code_t AMTExSetPMClass(AManagedTaskEx *_this, EPMClass eNewPMClass);
 extern EPMClass AMTExGetPMClass(AManagedTaskEx *_this);
+extern sys_error_code_t AMTExSetPMDependencies(AManagedTaskEx *_this, AManagedTask *const *pxDependencies, uint8_t nDependencies);
+extern boolean_t AMTExArePMDependenciesDone(AManagedTaskEx *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
 #endif
 
 
@@ -62,13 +65,12 @@ void AMTExRun(void *pParams) {
       sys_error_handler();
     }
 
-    /* check if there is a pending power mode switch request */
-    if (_this->m_xStatus.nPowerModeSwitchPending == 1U) {
-      /* clear the power mode switch delay because the task is ready to switch.*/
-      taskENTER_CRITICAL();
-      _this->m_xStatus.nDelayPowerModeSwitch = 0;
-      taskEXIT_CRITICAL();
-      vTaskSuspend(NULL);
+    /* check if there is a pending power mode switch request. If there is none, the power mode switch is delayed
+     until the end of the step. The check and the delay are a single atomic operation, so INIT cannot request
+     the switch in between.*/
+    if (!AMTStatusTryDelayPowerModeSwitch((AManagedTask*)_this)) {
+      /* the task is ready to switch: notify INIT and wait for the end of the transaction.*/
+      AMTWaitPowerModeSwitch((AManagedTask*)_this);
     }
     else {
       /* find the execute step function  */
@@ -76,18 +78,16 @@ void AMTExRun(void *pParams) {
       pExecuteStepFunc = _this->m_pfPMState2FuncMap[nPMState];
 
       if (pExecuteStepFunc != NULL) {
-        taskENTER_CRITICAL();
-        _this->m_xStatus.nDelayPowerModeSwitch = 1;
-        taskEXIT_CRITICAL();
+        AMTSP_STEP_BEGIN(_this);
         xRes = pExecuteStepFunc((AManagedTask*)_this);
-        taskENTER_CRITICAL();
-        _this->m_xStatus.nDelayPowerModeSwitch = 0;
-        taskEXIT_CRITICAL();
+        AMTSP_STEP_END(_this, nPMState);
+        (void)AMTStatusModify((AManagedTask*)_this, AMT_STATUS_DELAY_PM_SWITCH_Msk, 0U);
       }
       else {
-        /* there is no function so, we suspend the task.*/
+        (void)AMTStatusModify((AManagedTask*)_this, AMT_STATUS_DELAY_PM_SWITCH_Msk, 0U);
+        /* there is no function so, the task waits until INIT resumes it after a power mode switch.*/
         (void)AMTExSetInactiveState(_this, TRUE);
-        vTaskSuspend(_this->m_xThaskHandle);
+        AMTWaitStepFunction((AManagedTask*)_this);
         (void)AMTExSetInactiveState(_this, FALSE);
       }
 
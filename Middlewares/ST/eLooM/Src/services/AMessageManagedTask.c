@@ -0,0 +1,271 @@
+/**
+ ******************************************************************************
+ * @file    AMessageManagedTask.c
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief
+ *
+ * <DESCRIPTIOM>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+
+#include "services/AMessageManagedTask.h"
+#include "services/AMessageManagedTask_vtbl.h"
+#include <stddef.h>
+#include <string.h>
+
+
+/**
+ * Item of the inbox. Only the first m_nMessageSize bytes of the message are copied in the inbox,
+ * so the size of an item is ::AMMT_INBOX_ITEM_SIZE.
+ */
+typedef struct _AMMTEnvelope {
+  /**
+   * Specifies the tick count when the message has been posted.
+   */
+  TickType_t xPostTime;
+
+  /**
+   * Specifies the message.
+   */
+  uint8_t pnMessage[AMMT_CFG_MAX_MESSAGE_SIZE];
+} AMMTEnvelope;
+
+
+/*
+ GCC requires one function forward declaration in only one .c source
+ in order to manage the inline.
+ See also http://stackoverflow.com/questions/26503235/c-inline-function-and-gcc
+*/
+#if defined (__GNUC__) || defined (__ICCARM__)
+extern UBaseType_t AMMTGetInboxDepth(AMessageManagedTask *_this);
+extern AMMTStats AMMTGetStats(AMessageManagedTask *_this);
+extern sys_error_code_t AMMTResetStats(AMessageManagedTask *_this);
+extern sys_error_code_t AMMTProcessMessage(AMessageManagedTask *_this, void *pvMessage);
+#endif
+
+
+/* Private member function declaration */
+/***************************************/
+
+/**
+ * Wait until the inbox is not empty, or a power mode switch is pending. During the wait the task is inactive.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ */
+static void AMMTWaitForMessage(AMessageManagedTask *_this);
+
+/**
+ * Initialize the members of a message managed task, but the inbox.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @param nMessageSize [IN] specifies the size in byte of a message.
+ * @param nMaxBatchSize [IN] specifies the maximum number of messages processed in a step.
+ * @return \a SYS_NO_ERROR_CODE if success, the error code of AMTInitEx() otherwise.
+ */
+static sys_error_code_t AMMTInitMembers(AMessageManagedTask *_this, size_t nMessageSize, uint8_t nMaxBatchSize);
+
+
+/* Public API definition */
+/*************************/
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+sys_error_code_t AMMTInit(AMessageManagedTask *_this, size_t nMessageSize, UBaseType_t nInboxLength, uint8_t nMaxBatchSize) {
+  assert_param(_this != NULL);
+  assert_param((nMessageSize > 0U) && (nMessageSize <= AMMT_CFG_MAX_MESSAGE_SIZE));
+  assert_param(nMaxBatchSize > 0U);
+  sys_error_code_t xRes;
+
+  xRes = AMMTInitMembers(_this, nMessageSize, nMaxBatchSize);
+  if (!SYS_IS_ERROR_CODE(xRes)) {
+    _this->m_xInbox = xQueueCreate(nInboxLength, AMMT_INBOX_ITEM_SIZE(nMessageSize));
+    if (_this->m_xInbox == NULL) {
+      xRes = SYS_OUT_OF_MEMORY_ERROR_CODE;
+      SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+    }
+  }
+
+  return xRes;
+}
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+sys_error_code_t AMMTInitStatic(AMessageManagedTask *_this, size_t nMessageSize, UBaseType_t nInboxLength, uint8_t nMaxBatchSize,
+    uint8_t *pnInboxStorage, StaticQueue_t *pxInboxBuffer) {
+  assert_param(_this != NULL);
+  assert_param((nMessageSize > 0U) && (nMessageSize <= AMMT_CFG_MAX_MESSAGE_SIZE));
+  assert_param(nMaxBatchSize > 0U);
+  sys_error_code_t xRes;
+
+  xRes = AMMTInitMembers(_this, nMessageSize, nMaxBatchSize);
+  if (SYS_IS_ERROR_CODE(xRes)) {
+    /* the error code has been set by AMTInitEx().*/
+  }
+  else if ((pnInboxStorage == NULL) || (pxInboxBuffer == NULL)) {
+    xRes = SYS_INVALID_PARAMETER_ERROR_CODE;
+    SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+  }
+  else {
+    _this->m_xInbox = xQueueCreateStatic(nInboxLength, AMMT_INBOX_ITEM_SIZE(nMessageSize), pnInboxStorage, pxInboxBuffer);
+  }
+
+  return xRes;
+}
+#endif
+
+sys_error_code_t AMMTPost(AMessageManagedTask *_this, const void *pvMessage, TickType_t xTimeout) {
+  assert_param(_this != NULL);
+  assert_param(pvMessage != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  AMMTEnvelope xEnvelope;
+
+  xEnvelope.xPostTime = xTaskGetTickCount();
+  (void)memcpy(xEnvelope.pnMessage, pvMessage, _this->m_nMessageSize);
+
+  if (xQueueSendToBack(_this->m_xInbox, &xEnvelope, xTimeout) == pdTRUE) {
+    if (_this->super.m_xThaskHandle != NULL) {
+      (void)xTaskNotifyGive(_this->super.m_xThaskHandle);
+    }
+    taskENTER_CRITICAL();
+    _this->m_xStats.nPostedCount++;
+    taskEXIT_CRITICAL();
+  }
+  else {
+    xRes = SYS_TASK_QUEUE_FULL_ERROR_CODE;
+    taskENTER_CRITICAL();
+    _this->m_xStats.nDroppedCount++;
+    taskEXIT_CRITICAL();
+  }
+
+  return xRes;
+}
+
+sys_error_code_t AMMTPostFromISR(AMessageManagedTask *_this, const void *pvMessage, BaseType_t *pxHigherPriorityTaskWoken) {
+  assert_param(_this != NULL);
+  assert_param(pvMessage != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  AMMTEnvelope xEnvelope;
+  UBaseType_t uxSavedInterruptStatus;
+
+  xEnvelope.xPostTime = xTaskGetTickCountFromISR();
+  (void)memcpy(xEnvelope.pnMessage, pvMessage, _this->m_nMessageSize);
+
+  if (xQueueSendToBackFromISR(_this->m_xInbox, &xEnvelope, pxHigherPriorityTaskWoken) == pdTRUE) {
+    if (_this->super.m_xThaskHandle != NULL) {
+      vTaskNotifyGiveFromISR(_this->super.m_xThaskHandle, pxHigherPriorityTaskWoken);
+    }
+    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    _this->m_xStats.nPostedCount++;
+    taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptStatus);
+  }
+  else {
+    xRes = SYS_TASK_QUEUE_FULL_ERROR_CODE;
+    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    _this->m_xStats.nDroppedCount++;
+    taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptStatus);
+  }
+
+  return xRes;
+}
+
+sys_error_code_t AMMTProcessInbox(AManagedTask *_this) {
+  assert_param(_this != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  sys_error_code_t xMessageRes;
+  AMessageManagedTask *pObj = (AMessageManagedTask*)_this;
+  AMMTEnvelope xEnvelope;
+  UBaseType_t nDepth;
+  TickType_t xLatency;
+  TickType_t xMaxLatency = 0;
+  uint32_t nLatencySum = 0;
+  uint8_t nCount = 0;
+
+  AMMTWaitForMessage(pObj);
+
+  nDepth = uxQueueMessagesWaiting(pObj->m_xInbox);
+  /* stop the batch as soon as a power mode switch is pending, so the task does not delay the PM transaction.*/
+  while ((nCount < pObj->m_nMaxBatchSize) && !AMTIsPowerModeSwitchPending(_this)
+      && (xQueueReceive(pObj->m_xInbox, &xEnvelope, 0) == pdTRUE)) {
+    xLatency = xTaskGetTickCount() - xEnvelope.xPostTime;
+    nLatencySum += xLatency;
+    if (xLatency > xMaxLatency) {
+      xMaxLatency = xLatency;
+    }
+
+    xMessageRes = AMMTProcessMessage(pObj, xEnvelope.pnMessage);
+    if (SYS_IS_ERROR_CODE(xMessageRes)) {
+      xRes = xMessageRes;
+    }
+    nCount++;
+  }
+
+  /* update the statistics once per batch.*/
+  if (nCount > 0U) {
+    taskENTER_CRITICAL();
+    pObj->m_xStats.nBatchCount++;
+    pObj->m_xStats.nProcessedCount += nCount;
+    pObj->m_xStats.nLatencySum += nLatencySum;
+    if (xMaxLatency > pObj->m_xStats.xMaxLatency) {
+      pObj->m_xStats.xMaxLatency = xMaxLatency;
+    }
+    if (nDepth > pObj->m_xStats.nMaxDepth) {
+      pObj->m_xStats.nMaxDepth = nDepth;
+    }
+    taskEXIT_CRITICAL();
+  }
+
+  return xRes;
+}
+
+
+// AManagedTaskEx virtual functions definition
+// *******************************************
+
+sys_error_code_t AMMT_vtblForceExecuteStep(AManagedTaskEx *_this, EPowerMode eActivePowerMode) {
+  assert_param(_this != NULL);
+  UNUSED(eActivePowerMode);
+
+  (void)xTaskNotifyGive(_this->m_xThaskHandle);
+
+  return SYS_NO_ERROR_CODE;
+}
+
+
+/* Private function definition */
+/*******************************/
+
+static void AMMTWaitForMessage(AMessageManagedTask *_this) {
+  /* the notification value counts the posts that are not yet seen by the task. It is cleared before checking
+   the inbox and the PM status: a post or a power mode switch request after this point gives a new notification,
+   so the task cannot miss it.*/
+  (void)ulTaskNotifyTake(pdTRUE, 0);
+
+  if (!AMTIsPowerModeSwitchPending((AManagedTask*)_this) && (uxQueueMessagesWaiting(_this->m_xInbox) == 0U)) {
+    (void)AMTExSetInactiveState(&_this->super, TRUE);
+    (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    (void)AMTExSetInactiveState(&_this->super, FALSE);
+  }
+}
+
+static sys_error_code_t AMMTInitMembers(AMessageManagedTask *_this, size_t nMessageSize, uint8_t nMaxBatchSize) {
+  sys_error_code_t xRes = AMTInitEx(&_this->super);
+
+  _this->m_xInbox = NULL;
+  _this->m_nMessageSize = (uint16_t)nMessageSize;
+  _this->m_nMaxBatchSize = nMaxBatchSize;
+  (void)AMMTResetStats(_this);
+
+  return xRes;
+}
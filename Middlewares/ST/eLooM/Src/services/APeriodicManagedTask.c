@@ -0,0 +1,215 @@
+/**
+ ******************************************************************************
+ * @file    APeriodicManagedTask.c
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief
+ *
+ * <DESCRIPTIOM>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+
+#include "services/APeriodicManagedTask.h"
+#include "services/APeriodicManagedTask_vtbl.h"
+#include "services/AMTStepProfiler.h"
+
+#if (INCLUDE_vTaskDelayUntil != 1) || (INCLUDE_xTaskAbortDelay != 1)
+#error APeriodicManagedTask requires INCLUDE_vTaskDelayUntil and INCLUDE_xTaskAbortDelay equal to 1.
+#endif
+
+
+/*
+ GCC requires one function forward declaration in only one .c source
+ in order to manage the inline.
+ See also http://stackoverflow.com/questions/26503235/c-inline-function-and-gcc
+*/
+#if defined (__GNUC__) || defined (__ICCARM__)
+extern sys_error_code_t APMTInit(APeriodicManagedTask *_this, const uint32_t *pnPMState2PeriodMap, EAPMTOverrunPolicy eOverrunPolicy);
+extern TickType_t APMTGetPeriod(APeriodicManagedTask *_this, EPowerMode ePowerMode);
+extern APMTStats APMTGetStats(APeriodicManagedTask *_this);
+extern sys_error_code_t APMTResetStats(APeriodicManagedTask *_this);
+#endif
+
+
+/* Private member function declaration */
+/***************************************/
+
+/**
+ * Wait for the release time of the next step. If the previous step ended after the release time,
+ * the task does not wait, and the overrun is managed according to the overrun policy.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ * @param xPeriod [IN] specifies the period in tick. If it is zero the step is released immediately.
+ * @return `TRUE` if the step is released, `FALSE` if the wait has been interrupted by APMT_vtblForceExecuteStep().
+ */
+static boolean_t APMTWaitForRelease(APeriodicManagedTask *_this, TickType_t xPeriod);
+
+/**
+ * Update the timing statistics with a released step.
+ *
+ * @param _this [IN] specifies a task object pointer.
+ */
+static void APMTUpdateStats(APeriodicManagedTask *_this);
+
+
+/* Public API definition */
+/*************************/
+
+void APMTRun(void *pParams) {
+  sys_error_code_t xRes;
+  APeriodicManagedTask *_this = (APeriodicManagedTask*)pParams;
+  AManagedTask *pxBase = (AManagedTask*)pParams;
+  pExecuteStepFunc_t pExecuteStepFunc = NULL;
+
+  /* At this point all system has been initialized.
+     Execute task specific delayed one time initialization. */
+  xRes = AMTOnEnterTaskControlLoop(pxBase);
+  if (SYS_IS_ERROR_CODE(xRes)) {
+    /* stop the system execution */
+    sys_error_handler();
+  }
+
+  for (;;) {
+    if(pxBase->m_pfPMState2FuncMap == NULL) {
+      sys_error_handler();
+    }
+
+    /* check if there is a pending power mode switch request. If there is none, the power mode switch is delayed
+     until the end of the step. The wait for the release time is inside the delay, and INIT interrupts it with
+     AMTExForceExecuteStep().*/
+    if (!AMTStatusTryDelayPowerModeSwitch(pxBase)) {
+      /* the task is ready to switch: notify INIT and wait for the end of the transaction.*/
+      AMTWaitPowerModeSwitch(pxBase);
+      /* the period can be changed, so the next step is released immediately.*/
+      _this->m_bResync = TRUE;
+    }
+    else {
+      /* find the execute step function  */
+      uint8_t nPMState = (uint8_t)AMTGetTaskPowerMode(pxBase);
+      pExecuteStepFunc = pxBase->m_pfPMState2FuncMap[nPMState];
+
+      if (pExecuteStepFunc != NULL) {
+        xRes = SYS_NO_ERROR_CODE;
+        if (APMTWaitForRelease(_this, APMTGetPeriod(_this, (EPowerMode)nPMState))) {
+          APMTUpdateStats(_this);
+          AMTSP_STEP_BEGIN(pxBase);
+          xRes = pExecuteStepFunc(pxBase);
+          AMTSP_STEP_END(pxBase, nPMState);
+        }
+        (void)AMTStatusModify(pxBase, AMT_STATUS_DELAY_PM_SWITCH_Msk, 0U);
+      }
+      else {
+        (void)AMTStatusModify(pxBase, AMT_STATUS_DELAY_PM_SWITCH_Msk, 0U);
+        /* there is no function so, the task waits until INIT resumes it after a power mode switch.*/
+        (void)AMTExSetInactiveState(&_this->super, TRUE);
+        AMTWaitStepFunction(pxBase);
+        (void)AMTExSetInactiveState(&_this->super, FALSE);
+        _this->m_bResync = TRUE;
+      }
+
+      /* notify the system that the task is working fine.*/
+      (void)AMTNotifyIsStillRunning(pxBase, xRes);
+    }
+  }
+}
+
+
+// AManagedTaskEx virtual functions definition
+// *******************************************
+
+sys_error_code_t APMT_vtblForceExecuteStep(AManagedTaskEx *_this, EPowerMode eActivePowerMode) {
+  assert_param(_this != NULL);
+  UNUSED(eActivePowerMode);
+  APeriodicManagedTask *pObj = (APeriodicManagedTask*)_this;
+
+  /* see APMTWaitForRelease().*/
+  if (pObj->m_bIsWaitingRelease) {
+    (void)xTaskAbortDelay(_this->m_xThaskHandle);
+  }
+
+  return SYS_NO_ERROR_CODE;
+}
+
+
+/* Private function definition */
+/*******************************/
+
+static boolean_t APMTWaitForRelease(APeriodicManagedTask *_this, TickType_t xPeriod) {
+  boolean_t bReleased = TRUE;
+  TickType_t xNow = xTaskGetTickCount();
+  TickType_t xElapsed;
+  TickType_t xMissed;
+
+  if (_this->m_bResync || (xPeriod == 0U)) {
+    _this->m_xLastReleaseTime = xNow;
+    _this->m_bResync = FALSE;
+  }
+  else {
+    xElapsed = xNow - _this->m_xLastReleaseTime;
+    /* when xElapsed is equal to xPeriod the task is exactly on its release time, so it is not an overrun:
+     vTaskDelayUntil() returns immediately and it moves the release time one period ahead.*/
+    if (xElapsed <= xPeriod) {
+      /* INIT sets the pending flag before it calls APMT_vtblForceExecuteStep(). The flag is checked and the task is
+       marked as waiting in the same critical section, so either the task sees the pending power mode switch,
+       or INIT sees the task waiting and aborts the wait. If INIT aborts the wait before the task is blocked,
+       it forces the step again after INIT_TASK_CFG_PM_SWITCH_DELAY_MS.*/
+      taskENTER_CRITICAL();
+      _this->m_bIsWaitingRelease = AMTIsPowerModeSwitchPending((AManagedTask*)_this) ? FALSE : TRUE;
+      taskEXIT_CRITICAL();
+      if (_this->m_bIsWaitingRelease) {
+        vTaskDelayUntil(&_this->m_xLastReleaseTime, xPeriod);
+        _this->m_bIsWaitingRelease = FALSE;
+        if ((TickType_t)(xTaskGetTickCount() - xNow) < (xPeriod - xElapsed)) {
+          /* the wait has been interrupted, so the release time does not change.*/
+          _this->m_xLastReleaseTime -= xPeriod;
+          bReleased = FALSE;
+        }
+      }
+      else {
+        /* do not wait the release time: the task is ready for the power mode switch.*/
+        bReleased = FALSE;
+      }
+    }
+    else {
+      /* the previous step ended after this release time.*/
+      xMissed = 0;
+      if (_this->m_eOverrunPolicy == (uint8_t)E_APMT_OVERRUN_SKIP) {
+        /* go to the last release time not after now. xElapsed is greater than xPeriod, so there is at least
+         one release time before now, and the ones in between are the missed periods.*/
+        xMissed = (xElapsed / xPeriod) - 1U;
+      }
+      _this->m_xLastReleaseTime += (xMissed + 1U) * xPeriod;
+
+      taskENTER_CRITICAL();
+      _this->m_xStats.nOverrunCount++;
+      _this->m_xStats.nSkippedCount += xMissed;
+      taskEXIT_CRITICAL();
+    }
+  }
+
+  return bReleased;
+}
+
+static void APMTUpdateStats(APeriodicManagedTask *_this) {
+  TickType_t xJitter = xTaskGetTickCount() - _this->m_xLastReleaseTime;
+
+  taskENTER_CRITICAL();
+  _this->m_xStats.nReleaseCount++;
+  _this->m_xStats.nJitterSum += xJitter;
+  if (xJitter > _this->m_xStats.xMaxJitter) {
+    _this->m_xStats.xMaxJitter = xJitter;
+  }
+  taskEXIT_CRITICAL();
+}
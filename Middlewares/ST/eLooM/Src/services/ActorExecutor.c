@@ -0,0 +1,283 @@
+/**
+ ******************************************************************************
+ * @file    ActorExecutor.c
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief
+ *
+ * <DESCRIPTIOM>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+
+#include "services/ActorExecutor.h"
+#include "services/ActorExecutor_vtbl.h"
+#include "services/sysmem.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+
+/**
+ * Class object declaration
+ */
+typedef struct _ActorExecutorClass {
+  /**
+   * ActorExecutor class virtual table.
+   */
+  AManagedTaskEx_vtbl m_xVTBL;
+} ActorExecutorClass;
+
+/**
+ * The class object.
+ */
+static const ActorExecutorClass s_xTheClass = {
+  /* Class virtual table */
+  {
+    ActorExecutor_vtblHardwareInit,
+    ActorExecutor_vtblOnCreateTask,
+    ActorExecutor_vtblDoEnterPowerMode,
+    ActorExecutor_vtblHandleError,
+    ActorExecutor_vtblOnEnterTaskControlLoop,
+    ActorExecutor_vtblForceExecuteStep,
+    ActorExecutor_vtblOnEnterPowerMode
+  }
+};
+
+/**
+ * ActorExecutor (PM_STATE, ExecuteStepFunc) map. The executor has the same step in all power modes,
+ * and the step uses the map of the actors. It is shared by all the executors.
+ */
+static pExecuteStepFunc_t s_pfPMState2FuncMap[ACTOR_EXECUTOR_CFG_MAX_PM_STATES];
+
+_Static_assert(ACTOR_EXECUTOR_CFG_MAX_PM_STATES >= (uint32_t)E_POWER_MODE_NONE,
+    "ACTOR_EXECUTOR_CFG_MAX_PM_STATES is smaller than the number of PM states of the application");
+
+
+/* Private member function declaration */
+/***************************************/
+
+/**
+ * Execute the step of the ready actors that have a step function in the current power mode.
+ * If no actor step is executed, the executor waits for AMAPost() or for INIT (see ActorExecutor_vtblForceExecuteStep()).
+ *
+ * @param _this [IN] specifies a pointer to a task object.
+ * @return SYS_NO_EROR_CODE if success, the error of the last actor step that failed otherwise.
+ */
+static sys_error_code_t ActorExecutorExecuteStep(AManagedTask *_this);
+
+
+/* Public API definition */
+/*************************/
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+AManagedTaskEx *ActorExecutorAlloc(const char *pcName, unsigned short nStackDepth, UBaseType_t xPriority) {
+  ActorExecutor *pNewObj = (ActorExecutor*)SysAlloc(sizeof(ActorExecutor));
+
+  AManagedTaskEx *pxObj = NULL;
+
+  if (pNewObj == NULL) {
+    SYS_SET_SERVICE_LEVEL_ERROR_CODE(SYS_OUT_OF_MEMORY_ERROR_CODE);
+  }
+  else {
+    pxObj = ActorExecutorStaticAlloc(pNewObj, pcName, nStackDepth, xPriority);
+    if (pxObj == NULL) {
+      SysFree(pNewObj);
+    }
+  }
+
+  return pxObj;
+}
+#endif
+
+AManagedTaskEx *ActorExecutorStaticAlloc(ActorExecutor *pxMemBlock, const char *pcName, unsigned short nStackDepth, UBaseType_t xPriority) {
+  if ((pxMemBlock != NULL) && SYS_IS_ERROR_CODE(AMTInitEx(&pxMemBlock->super))) {
+    /* the error code has been set by AMTInitEx().*/
+    pxMemBlock = NULL;
+  }
+  if (pxMemBlock != NULL) {
+    pxMemBlock->super.vptr = &s_xTheClass.m_xVTBL;
+    pxMemBlock->m_pxActors = NULL;
+    pxMemBlock->m_pcName = pcName;
+    pxMemBlock->m_nStackDepth = nStackDepth;
+    pxMemBlock->m_xPriority = xPriority;
+  }
+
+  return (AManagedTaskEx*)pxMemBlock;
+}
+
+sys_error_code_t ActorExecutorAddActor(AManagedTaskEx *_this, AManagedActor *pxActor) {
+  assert_param(_this != NULL);
+  assert_param(pxActor != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  ActorExecutor *pObj = (ActorExecutor*)_this;
+  AManagedActor **ppxLast = &pObj->m_pxActors;
+
+  if (pxActor->m_pxExecutor != NULL) {
+    xRes = SYS_INVALID_PARAMETER_ERROR_CODE;
+    SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+  }
+  else {
+    /* the actors are executed in the order they are added.*/
+    while (*ppxLast != NULL) {
+      ppxLast = &(*ppxLast)->m_pNext;
+    }
+    pxActor->m_pNext = NULL;
+    pxActor->m_pxExecutor = _this;
+    *ppxLast = pxActor;
+  }
+
+  return xRes;
+}
+
+
+// AManagedTask virtual functions definition
+// *****************************************
+
+sys_error_code_t ActorExecutor_vtblHardwareInit(AManagedTask *_this, void *pParams) {
+  assert_param(_this != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  ActorExecutor *pObj = (ActorExecutor*)_this;
+
+  for (AManagedActor *pxActor = pObj->m_pxActors; (pxActor != NULL) && !SYS_IS_ERROR_CODE(xRes); pxActor = pxActor->m_pNext) {
+    xRes = AMAHardwareInit(pxActor, pParams);
+  }
+
+  return xRes;
+}
+
+sys_error_code_t ActorExecutor_vtblOnCreateTask(AManagedTask *_this, TaskFunction_t *pvTaskCode, const char **pcName, unsigned short *pnStackDepth, void **pParams, UBaseType_t *pxPriority) {
+  assert_param(_this != NULL);
+  ActorExecutor *pObj = (ActorExecutor*)_this;
+
+  for (uint8_t i = 0; i < ACTOR_EXECUTOR_CFG_MAX_PM_STATES; ++i) {
+    s_pfPMState2FuncMap[i] = ActorExecutorExecuteStep;
+  }
+  _this->m_pfPMState2FuncMap = s_pfPMState2FuncMap;
+
+  *pvTaskCode = AMTExRun;
+  *pcName = pObj->m_pcName;
+  *pnStackDepth = pObj->m_nStackDepth;
+  *pParams = _this;
+  *pxPriority = pObj->m_xPriority;
+
+  return SYS_NO_ERROR_CODE;
+}
+
+sys_error_code_t ActorExecutor_vtblDoEnterPowerMode(AManagedTask *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode) {
+  assert_param(_this != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  sys_error_code_t xActorRes;
+  ActorExecutor *pObj = (ActorExecutor*)_this;
+
+  /* all the actors do the transaction, also if one of them fails.*/
+  for (AManagedActor *pxActor = pObj->m_pxActors; pxActor != NULL; pxActor = pxActor->m_pNext) {
+    xActorRes = AMADoEnterPowerMode(pxActor, eActivePowerMode, eNewPowerMode);
+    if (SYS_IS_ERROR_CODE(xActorRes)) {
+      xRes = xActorRes;
+    }
+  }
+
+  return xRes;
+}
+
+sys_error_code_t ActorExecutor_vtblHandleError(AManagedTask *_this, SysEvent xError) {
+  assert_param(_this != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  sys_error_code_t xActorRes;
+  ActorExecutor *pObj = (ActorExecutor*)_this;
+
+  for (AManagedActor *pxActor = pObj->m_pxActors; pxActor != NULL; pxActor = pxActor->m_pNext) {
+    xActorRes = AMAHandleError(pxActor, xError);
+    if (SYS_IS_ERROR_CODE(xActorRes)) {
+      xRes = xActorRes;
+    }
+  }
+
+  return xRes;
+}
+
+sys_error_code_t ActorExecutor_vtblOnEnterTaskControlLoop(AManagedTask *_this) {
+  assert_param(_this != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  ActorExecutor *pObj = (ActorExecutor*)_this;
+
+  for (AManagedActor *pxActor = pObj->m_pxActors; (pxActor != NULL) && !SYS_IS_ERROR_CODE(xRes); pxActor = pxActor->m_pNext) {
+    xRes = AMAOnEnterControlLoop(pxActor);
+  }
+
+  return xRes;
+}
+
+
+// AManagedTaskEx virtual functions definition
+// *******************************************
+
+sys_error_code_t ActorExecutor_vtblForceExecuteStep(AManagedTaskEx *_this, EPowerMode eActivePowerMode) {
+  assert_param(_this != NULL);
+  UNUSED(eActivePowerMode);
+
+  /* wake up the executor if it is waiting for an actor, so it ends the step.*/
+  (void)xTaskNotifyGive(_this->m_xThaskHandle);
+
+  return SYS_NO_ERROR_CODE;
+}
+
+sys_error_code_t ActorExecutor_vtblOnEnterPowerMode(AManagedTaskEx *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode) {
+  assert_param(_this != NULL);
+  UNUSED(eActivePowerMode);
+  UNUSED(eNewPowerMode);
+
+  return SYS_NO_ERROR_CODE;
+}
+
+
+/* Private function definition */
+/*******************************/
+
+static sys_error_code_t ActorExecutorExecuteStep(AManagedTask *_this) {
+  assert_param(_this != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  sys_error_code_t xActorRes;
+  ActorExecutor *pObj = (ActorExecutor*)_this;
+  EPowerMode ePowerMode = AMTGetSystemPowerMode();
+  pActorStepFunc_t pfActorStep;
+  boolean_t bIsStepDone = FALSE;
+
+  for (AManagedActor *pxActor = pObj->m_pxActors; pxActor != NULL; pxActor = pxActor->m_pNext) {
+    if (pxActor->m_bIsReady) {
+      pfActorStep = AMAGetStepFunc(pxActor, ePowerMode);
+      /* an actor without a step in this power mode remains ready until the power mode changes.*/
+      if (pfActorStep != NULL) {
+        pxActor->m_bIsReady = FALSE;
+        xActorRes = pfActorStep(pxActor);
+        bIsStepDone = TRUE;
+        if (SYS_IS_ERROR_CODE(xActorRes)) {
+          if (pxActor->m_nErrorCount < MT_MAX_ERROR_COUNT) {
+            pxActor->m_nErrorCount++;
+          }
+          xRes = xActorRes;
+        }
+      }
+    }
+  }
+
+  if (!bIsStepDone) {
+    /* no actor is ready, so wait for an actor or for INIT without a timeout.*/
+    (void)AMTExSetInactiveState(&pObj->super, TRUE);
+    (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    (void)AMTExSetInactiveState(&pObj->super, FALSE);
+  }
+
+  return xRes;
+}
@@ -22,9 +22,38 @@
 
 #include "services/ApplicationContext.h"
 
+#define AC_IS_KIND_OF_AMTEX(pTask)            ((pTask)->m_xStatus.nReserved == 1U)
+
 // Private member function declaration
 // ***********************************
 
+/**
+ * Get the PM class of a task. An AManagedTask belongs always to E_PM_CLASS_0.
+ *
+ * @param pTask specifies a pointer to a managed task object.
+ * @return the PM class of the task.
+ */
+static inline EPMClass ACGetTaskPMClass(AManagedTask *pTask);
+
+/**
+ * Add a task in the bucket of a PM class.
+ *
+ * @param _this specifies a pointer to the application context object.
+ * @param pTask specifies a pointer to a managed task object.
+ * @param ePMClass specifies the PM class.
+ */
+static void ACPushTaskInPMClass(ApplicationContext *_this, AManagedTask *pTask, EPMClass ePMClass);
+
+/**
+ * Remove a task from the bucket of a PM class.
+ *
+ * @param _this specifies a pointer to the application context object.
+ * @param pTask specifies a pointer to a managed task object.
+ * @param ePMClass specifies the PM class.
+ * @return TRUE if the task has been removed, FALSE if the task is not in the bucket.
+ */
+static boolean_t ACPopTaskFromPMClass(ApplicationContext *_this, AManagedTask *pTask, EPMClass ePMClass);
+
 // Inline function forward declaration
 // ***********************************
 
@@ -32,6 +61,9 @@
 extern uint8_t ACGetTaskCount(ApplicationContext *this);
 extern AManagedTask *ACGetFirstTask(ApplicationContext *this);
 extern AManagedTask *ACGetNextTask(ApplicationContext *this, const AManagedTask *pTask);
+extern uint8_t ACGetTaskCountInPMClass(ApplicationContext *this, EPMClass ePMClass);
+extern AManagedTask *ACGetFirstTaskInPMClass(ApplicationContext *this, EPMClass ePMClass);
+extern AManagedTask *ACGetNextTaskInPMClass(ApplicationContext *this, const AManagedTask *pTask);
 #endif
 
 // Public API definition
@@ -42,6 +74,10 @@ sys_error_code_t ACInit(ApplicationContext *this) {
 
 	this->m_nListSize = 0;
 	this->m_pHead = NULL;
+	for (uint8_t i = 0; i < AMT_PM_CLASS_COUNT; ++i) {
+		this->m_pPMClassHead[i] = NULL;
+		this->m_nPMClassSize[i] = 0;
+	}
 
 	return SYS_NO_ERROR_CODE;
 }
@@ -64,23 +100,121 @@ sys_error_code_t ACAddTask(ApplicationContext *this, AManagedTask *pTask) {
 		}
 		else {
 			// add the task in the context.
-			pTask->m_pNext = this->m_pHead;
-			this->m_pHead = pTask;
-			this->m_nListSize++;
+			xRes = ACPushTask(this, pTask);
 		}
 	}
 
 	return xRes;
 }
 
+sys_error_code_t ACPushTask(ApplicationContext *this, AManagedTask *pTask) {
+	assert_param(this != NULL);
+	assert_param(pTask != NULL);
+	sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+
+	if ((uint8_t)ACGetTaskPMClass(pTask) >= AMT_PM_CLASS_COUNT) {
+		// there is no bucket for the PM class of the task.
+		xRes = SYS_INVALID_PARAMETER_ERROR_CODE;
+		SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+	}
+	else {
+		// a task can be added also at runtime (see SysLoadTask()).
+		taskENTER_CRITICAL();
+		pTask->m_pNext = this->m_pHead;
+		this->m_pHead = pTask;
+		this->m_nListSize++;
+		pTask->m_pxContext = this;
+		ACPushTaskInPMClass(this, pTask, ACGetTaskPMClass(pTask));
+		taskEXIT_CRITICAL();
+	}
+
+	return xRes;
+}
+
 sys_error_code_t ACRemoveTask(ApplicationContext *this, AManagedTask *pTask) {
 	assert_param(this != NULL);
 	sys_error_code_t xRes = SYS_NO_ERROR_CODE;
-	UNUSED(pTask);
+	AManagedTask **ppTask = &this->m_pHead;
+
+	if (pTask != NULL) {
+		// the buckets can be modified by a task while INIT is removing the task.
+		taskENTER_CRITICAL();
+		while ((*ppTask != NULL) && (*ppTask != pTask)) {
+			ppTask = &(*ppTask)->m_pNext;
+		}
+
+		if (*ppTask == pTask) {
+			*ppTask = pTask->m_pNext;
+			pTask->m_pNext = NULL;
+			this->m_nListSize--;
+			(void)ACPopTaskFromPMClass(this, pTask, ACGetTaskPMClass(pTask));
+			pTask->m_pxContext = NULL;
+		}
+		else {
+			xRes = SYS_AC_TASK_NOT_FOUND_ERROR_CODE;
+		}
+		taskEXIT_CRITICAL();
+
+		if (SYS_IS_ERROR_CODE(xRes)) {
+			SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+		}
+	}
+
+	return xRes;
+}
+
+sys_error_code_t ACSetTaskPMClass(ApplicationContext *this, AManagedTask *pTask, EPMClass eNewPMClass) {
+	assert_param(this != NULL);
+	assert_param(pTask != NULL);
+	sys_error_code_t xRes = SYS_NO_ERROR_CODE;
 
-	// TODO: STF - TO BE IMPLEMENTED
+	if (AC_IS_KIND_OF_AMTEX(pTask) && ((uint8_t)eNewPMClass < AMT_PM_CLASS_COUNT)
+			&& ACPopTaskFromPMClass(this, pTask, ACGetTaskPMClass(pTask))) {
+		ACPushTaskInPMClass(this, pTask, eNewPMClass);
+		// the PM class is changed only after the task has been moved.
+		((AManagedTaskEx*)pTask)->m_xStatusEx.nPowerModeClass = (uint8_t)eNewPMClass;
+	}
+	else {
+		xRes = SYS_INVALID_PARAMETER_ERROR_CODE;
+	}
 
-	sys_error_handler();
+	if (SYS_IS_ERROR_CODE(xRes)) {
+		SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+	}
 
 	return xRes;
 }
+
+
+// Private function definition
+// ***************************
+
+static inline EPMClass ACGetTaskPMClass(AManagedTask *pTask) {
+	return AC_IS_KIND_OF_AMTEX(pTask) ? AMTExGetPMClass((AManagedTaskEx*)pTask) : E_PM_CLASS_0;
+}
+
+static void ACPushTaskInPMClass(ApplicationContext *this, AManagedTask *pTask, EPMClass ePMClass) {
+	assert_param((uint8_t)ePMClass < AMT_PM_CLASS_COUNT);
+	pTask->m_pNextInPMClass = this->m_pPMClassHead[(uint8_t)ePMClass];
+	this->m_pPMClassHead[(uint8_t)ePMClass] = pTask;
+	this->m_nPMClassSize[(uint8_t)ePMClass]++;
+}
+
+static boolean_t ACPopTaskFromPMClass(ApplicationContext *this, AManagedTask *pTask, EPMClass ePMClass) {
+	assert_param((uint8_t)ePMClass < AMT_PM_CLASS_COUNT);
+	boolean_t bRes = FALSE;
+	AManagedTask **ppTask = &this->m_pPMClassHead[(uint8_t)ePMClass];
+
+	while ((*ppTask != NULL) && (*ppTask != pTask)) {
+		ppTask = &(*ppTask)->m_pNextInPMClass;
+	}
+
+	if (*ppTask == pTask) {
+		*ppTask = pTask->m_pNextInPMClass;
+		pTask->m_pNextInPMClass = NULL;
+		this->m_nPMClassSize[(uint8_t)ePMClass]--;
+		bRes = TRUE;
+	}
+
+	return bRes;
+}
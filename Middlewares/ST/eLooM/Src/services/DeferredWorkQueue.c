@@ -0,0 +1,389 @@
+/**
+ ******************************************************************************
+ * @file    DeferredWorkQueue.c
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief
+ *
+ * <DESCRIPTIOM>
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+
+#include "services/DeferredWorkQueue.h"
+#include "services/DeferredWorkQueue_vtbl.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define DWQ_RING_MASK                         (DWQ_CFG_RING_SIZE - 1U)
+
+/**
+ * On the cores that support the exclusive access instructions (Cortex-M3 and above) the submitters reserve
+ * a slot of the ring without a critical section. On the other cores the reservation is done in a critical section.
+ */
+#if defined(__CORTEX_M) && (__CORTEX_M >= 3U)
+#define DWQ_USE_EXCLUSIVE_ACCESS              1
+#else
+#define DWQ_USE_EXCLUSIVE_ACCESS              0
+#endif
+
+
+/**
+ * Class object declaration
+ */
+typedef struct _DeferredWorkQueueClass {
+  /**
+   * DeferredWorkQueue class virtual table.
+   */
+  AManagedTaskEx_vtbl m_xVTBL;
+} DeferredWorkQueueClass;
+
+/**
+ * The class object.
+ */
+static const DeferredWorkQueueClass s_xTheClass = {
+  /* Class virtual table */
+  {
+    DWQ_vtblHardwareInit,
+    DWQ_vtblOnCreateTask,
+    DWQ_vtblDoEnterPowerMode,
+    DWQ_vtblHandleError,
+    DWQ_vtblOnEnterTaskControlLoop,
+    DWQ_vtblForceExecuteStep,
+    DWQ_vtblOnEnterPowerMode
+  }
+};
+
+/**
+ * The only instance of the deferred work queue.
+ */
+static DeferredWorkQueue s_xTheQueue;
+
+/**
+ * DeferredWorkQueue (PM_STATE, ExecuteStepFunc) map. The work items are executed in all power modes.
+ */
+static pExecuteStepFunc_t s_pfPMState2FuncMap[DWQ_CFG_MAX_PM_STATES];
+
+_Static_assert(DWQ_CFG_MAX_PM_STATES >= (uint32_t)E_POWER_MODE_NONE,
+    "DWQ_CFG_MAX_PM_STATES is smaller than the number of PM states of the application");
+
+
+/* Private member function declaration */
+/***************************************/
+
+/**
+ * Execute up to ::DWQ_CFG_MAX_BATCH_SIZE work items. If there is no work item, the task waits for
+ * a submitter or for INIT (see DWQ_vtblForceExecuteStep()).
+ *
+ * @param _this [IN] specifies a pointer to a task object.
+ * @return SYS_NO_EROR_CODE if success, the error of the last work item that failed otherwise.
+ */
+static sys_error_code_t DWQExecuteStep(AManagedTask *_this);
+
+/**
+ * Reserve a slot in the ring and write the work item.
+ *
+ * @param pfWork [IN] specifies the work item function.
+ * @param pvArg [IN] specifies the argument passed to the work item function.
+ * @param nParam [IN] specifies the parameter passed to the work item function.
+ * @return \a SYS_NO_ERROR_CODE if success, SYS_TASK_QUEUE_FULL_ERROR_CODE if the ring is full.
+ */
+static sys_error_code_t DWQPush(pDWQWorkFunc_t pfWork, void *pvArg, uint32_t nParam);
+
+/**
+ * Read the next work item if it is ready.
+ *
+ * @param _this [IN] specifies a pointer to a task object.
+ * @param pxItem [OUT] specifies the work item.
+ * @return `TRUE` if a work item has been read, `FALSE` otherwise.
+ */
+static boolean_t DWQPop(DeferredWorkQueue *_this, DWQSlot *pxItem);
+
+/**
+ * Check if the next work item is ready.
+ *
+ * @param _this [IN] specifies a pointer to a task object.
+ * @return `TRUE` if the next work item is ready, `FALSE` otherwise.
+ */
+static inline boolean_t DWQIsItemReady(DeferredWorkQueue *_this);
+
+/**
+ * Atomically set the head of the ring to a new value, if it is equal to an expected value.
+ *
+ * @param pnHead [IN] specifies the head of the ring.
+ * @param nExpected [IN] specifies the expected value.
+ * @param nNew [IN] specifies the new value.
+ * @return `TRUE` if the head has been updated, `FALSE` otherwise.
+ */
+static inline boolean_t DWQCompareAndSwap(volatile uint32_t *pnHead, uint32_t nExpected, uint32_t nNew);
+
+
+/* Public API definition */
+/*************************/
+
+AManagedTaskEx *DWQAlloc(void) {
+  AManagedTaskEx *pxObj = NULL;
+
+  if (!SYS_IS_ERROR_CODE(AMTInitEx(&s_xTheQueue.super))) {
+    s_xTheQueue.super.vptr = &s_xTheClass.m_xVTBL;
+    s_xTheQueue.m_nHead = 0;
+    s_xTheQueue.m_nTail = 0;
+    for (uint32_t i = 0; i < DWQ_CFG_RING_SIZE; ++i) {
+      s_xTheQueue.m_xRing[i].nSequence = i;
+    }
+    s_xTheQueue.m_xStats.nExecutedCount = 0;
+    s_xTheQueue.m_xStats.nDroppedCount = 0;
+    s_xTheQueue.m_xStats.nBatchCount = 0;
+    s_xTheQueue.m_xStats.nMaxDepth = 0;
+    pxObj = &s_xTheQueue.super;
+  }
+
+  return pxObj;
+}
+
+sys_error_code_t DWQSubmitFromISR(pDWQWorkFunc_t pfWork, void *pvArg, uint32_t nParam, BaseType_t *pxHigherPriorityTaskWoken) {
+  assert_param(pfWork != NULL);
+  sys_error_code_t xRes;
+
+  xRes = DWQPush(pfWork, pvArg, nParam);
+  if (!SYS_IS_ERROR_CODE(xRes) && (s_xTheQueue.super.m_xThaskHandle != NULL)) {
+    vTaskNotifyGiveFromISR(s_xTheQueue.super.m_xThaskHandle, pxHigherPriorityTaskWoken);
+  }
+
+  return xRes;
+}
+
+sys_error_code_t DWQSubmit(pDWQWorkFunc_t pfWork, void *pvArg, uint32_t nParam) {
+  assert_param(pfWork != NULL);
+  sys_error_code_t xRes;
+
+  xRes = DWQPush(pfWork, pvArg, nParam);
+  if (!SYS_IS_ERROR_CODE(xRes) && (s_xTheQueue.super.m_xThaskHandle != NULL)) {
+    (void)xTaskNotifyGive(s_xTheQueue.super.m_xThaskHandle);
+  }
+
+  return xRes;
+}
+
+DWQStats DWQGetStats(void) {
+  DWQStats xStats;
+
+  taskENTER_CRITICAL();
+  xStats = s_xTheQueue.m_xStats;
+  taskEXIT_CRITICAL();
+
+  return xStats;
+}
+
+
+// AManagedTask virtual functions definition
+// *****************************************
+
+sys_error_code_t DWQ_vtblHardwareInit(AManagedTask *_this, void *pParams) {
+  assert_param(_this != NULL);
+  UNUSED(pParams);
+
+  return SYS_NO_ERROR_CODE;
+}
+
+sys_error_code_t DWQ_vtblOnCreateTask(AManagedTask *_this, TaskFunction_t *pvTaskCode, const char **pcName, unsigned short *pnStackDepth, void **pParams, UBaseType_t *pxPriority) {
+  assert_param(_this != NULL);
+
+  for (uint8_t i = 0; i < DWQ_CFG_MAX_PM_STATES; ++i) {
+    s_pfPMState2FuncMap[i] = DWQExecuteStep;
+  }
+  _this->m_pfPMState2FuncMap = s_pfPMState2FuncMap;
+
+  *pvTaskCode = AMTExRun;
+  *pcName = "DWQ";
+  *pnStackDepth = DWQ_TASK_CFG_STACK_DEPTH;
+  *pParams = _this;
+  *pxPriority = DWQ_TASK_CFG_PRIORITY;
+
+  return SYS_NO_ERROR_CODE;
+}
+
+sys_error_code_t DWQ_vtblDoEnterPowerMode(AManagedTask *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode) {
+  assert_param(_this != NULL);
+  UNUSED(eActivePowerMode);
+  UNUSED(eNewPowerMode);
+
+  return SYS_NO_ERROR_CODE;
+}
+
+sys_error_code_t DWQ_vtblHandleError(AManagedTask *_this, SysEvent xError) {
+  assert_param(_this != NULL);
+  UNUSED(xError);
+
+  return SYS_NO_ERROR_CODE;
+}
+
+sys_error_code_t DWQ_vtblOnEnterTaskControlLoop(AManagedTask *_this) {
+  assert_param(_this != NULL);
+
+  return SYS_NO_ERROR_CODE;
+}
+
+
+// AManagedTaskEx virtual functions definition
+// *******************************************
+
+sys_error_code_t DWQ_vtblForceExecuteStep(AManagedTaskEx *_this, EPowerMode eActivePowerMode) {
+  assert_param(_this != NULL);
+  UNUSED(eActivePowerMode);
+
+  /* wake up the task if it is waiting for a work item, so it ends the step.*/
+  (void)xTaskNotifyGive(_this->m_xThaskHandle);
+
+  return SYS_NO_ERROR_CODE;
+}
+
+sys_error_code_t DWQ_vtblOnEnterPowerMode(AManagedTaskEx *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode) {
+  assert_param(_this != NULL);
+  UNUSED(eActivePowerMode);
+  UNUSED(eNewPowerMode);
+
+  return SYS_NO_ERROR_CODE;
+}
+
+
+/* Private function definition */
+/*******************************/
+
+static sys_error_code_t DWQExecuteStep(AManagedTask *_this) {
+  assert_param(_this != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  sys_error_code_t xWorkRes;
+  DeferredWorkQueue *pObj = (DeferredWorkQueue*)_this;
+  DWQSlot xItem;
+  uint32_t nDepth;
+  uint32_t nCount = 0;
+
+  /* the notification is cleared before checking the ring and the PM status: a submission or a power mode switch
+   request after this point gives a new notification, so the task cannot miss it.*/
+  (void)ulTaskNotifyTake(pdTRUE, 0);
+  if (!AMTIsPowerModeSwitchPending(_this) && !DWQIsItemReady(pObj)) {
+    (void)AMTExSetInactiveState(&pObj->super, TRUE);
+    (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    (void)AMTExSetInactiveState(&pObj->super, FALSE);
+  }
+
+  nDepth = pObj->m_nHead - pObj->m_nTail;
+  /* stop the batch as soon as a power mode switch is pending, so the task does not delay the PM transaction.*/
+  while ((nCount < DWQ_CFG_MAX_BATCH_SIZE) && !AMTIsPowerModeSwitchPending(_this) && DWQPop(pObj, &xItem)) {
+    xWorkRes = xItem.pfWork(xItem.pvArg, xItem.nParam);
+    if (SYS_IS_ERROR_CODE(xWorkRes)) {
+      xRes = xWorkRes;
+    }
+    nCount++;
+  }
+
+  if (nCount > 0U) {
+    taskENTER_CRITICAL();
+    pObj->m_xStats.nBatchCount++;
+    pObj->m_xStats.nExecutedCount += nCount;
+    if (nDepth > pObj->m_xStats.nMaxDepth) {
+      pObj->m_xStats.nMaxDepth = nDepth;
+    }
+    taskEXIT_CRITICAL();
+  }
+
+  return xRes;
+}
+
+static sys_error_code_t DWQPush(pDWQWorkFunc_t pfWork, void *pvArg, uint32_t nParam) {
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  DeferredWorkQueue *_this = &s_xTheQueue;
+  DWQSlot *pxSlot;
+  UBaseType_t uxSavedInterruptStatus;
+  uint32_t nPos;
+  int32_t nDiff;
+  boolean_t bIsReserved = FALSE;
+
+  /* each slot has a sequence number: it is equal to the position when the slot is free, and to the position + 1
+   when the work item is ready. A submitter reserves a position by moving the head. If it is preempted by another
+   submitter, the other one reserves the next position.*/
+  do {
+    nPos = _this->m_nHead;
+    pxSlot = &_this->m_xRing[nPos & DWQ_RING_MASK];
+    nDiff = (int32_t)(pxSlot->nSequence - nPos);
+    if (nDiff == 0) {
+      bIsReserved = DWQCompareAndSwap(&_this->m_nHead, nPos, nPos + 1U);
+    }
+  } while (!bIsReserved && (nDiff >= 0));
+
+  if (bIsReserved) {
+    pxSlot->pfWork = pfWork;
+    pxSlot->pvArg = pvArg;
+    pxSlot->nParam = nParam;
+    /* publish the work item after it is written.*/
+    __DMB();
+    pxSlot->nSequence = nPos + 1U;
+  }
+  else {
+    /* the slot has not yet been read by the task, so the ring is full.*/
+    xRes = SYS_TASK_QUEUE_FULL_ERROR_CODE;
+    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    _this->m_xStats.nDroppedCount++;
+    taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptStatus);
+  }
+
+  return xRes;
+}
+
+static boolean_t DWQPop(DeferredWorkQueue *_this, DWQSlot *pxItem) {
+  DWQSlot *pxSlot = &_this->m_xRing[_this->m_nTail & DWQ_RING_MASK];
+  boolean_t bRes = FALSE;
+
+  if (DWQIsItemReady(_this)) {
+    pxItem->pfWork = pxSlot->pfWork;
+    pxItem->pvArg = pxSlot->pvArg;
+    pxItem->nParam = pxSlot->nParam;
+    /* free the slot after it is read.*/
+    __DMB();
+    pxSlot->nSequence = _this->m_nTail + DWQ_CFG_RING_SIZE;
+    _this->m_nTail++;
+    bRes = TRUE;
+  }
+
+  return bRes;
+}
+
+static inline boolean_t DWQIsItemReady(DeferredWorkQueue *_this) {
+  /* a reserved slot is not ready until the submitter has written the work item. The submitter notifies
+   the task after that, so the task waits instead of polling the slot.*/
+  return (_this->m_xRing[_this->m_nTail & DWQ_RING_MASK].nSequence == (_this->m_nTail + 1U)) ? TRUE : FALSE;
+}
+
+static inline boolean_t DWQCompareAndSwap(volatile uint32_t *pnHead, uint32_t nExpected, uint32_t nNew) {
+  boolean_t bRes = FALSE;
+
+#if (DWQ_USE_EXCLUSIVE_ACCESS == 1)
+  if (__LDREXW(pnHead) == nExpected) {
+    bRes = (__STREXW(nNew, pnHead) == 0U) ? TRUE : FALSE;
+  }
+  else {
+    __CLREX();
+  }
+#else
+  UBaseType_t uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+  if (*pnHead == nExpected) {
+    *pnHead = nNew;
+    bRes = TRUE;
+  }
+  taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptStatus);
+#endif
+
+  return bRes;
+}
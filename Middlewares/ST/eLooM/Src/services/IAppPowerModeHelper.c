@@ -31,7 +31,9 @@
 #if defined (__GNUC__) || defined (__ICCARM__)
 extern sys_error_code_t IapmhInit(IAppPowerModeHelper *this);
 extern EPowerMode IapmhComputeNewPowerMode(IAppPowerModeHelper *this, const SysEvent xEvent);
+extern EPowerMode IapmhComputeNewPowerModeFrom(IAppPowerModeHelper *this, const EPowerMode eFromPowerMode, const SysEvent xEvent);
 extern boolean_t IapmhCheckPowerModeTransaction(IAppPowerModeHelper *this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
+extern boolean_t IapmhIsPowerModeTransactionValid(IAppPowerModeHelper *this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
 extern sys_error_code_t IapmhDidEnterPowerMode(IAppPowerModeHelper *this, EPowerMode ePowerMode);
 extern EPowerMode IapmhGetActivePowerMode(IAppPowerModeHelper *this);
 extern SysPowerStatus IapmhGetPowerStatus(IAppPowerModeHelper *this);
@@ -0,0 +1,328 @@
+/**
+ ******************************************************************************
+ * @file    PMProfiler.c
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Profiler of the power mode transactions.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+
+#include "services/PMProfiler.h"
+#include "services/SysTimestamp.h"
+
+#if (INIT_TASK_CFG_ENABLE_PM_PROFILER == 1)
+
+#include "services/sysdebug.h"
+#include <string.h>
+#include <stdio.h>
+
+
+#define SYS_DEBUGF(level, message)            SYS_DEBUGF3(SYS_DBG_INIT, level, message)
+
+
+/**
+ * Create a type name for _PMProfiler.
+ */
+typedef struct _PMProfiler PMProfiler;
+
+/**
+ * Internal state of the profiler. Only INIT uses the profiler, so it is not protected.
+ */
+struct _PMProfiler {
+  /**
+   * Specifies the statistics of the transaction pairs.
+   */
+  PMPTransitionStats m_xTransitions[PMP_CFG_MAX_TRANSITIONS];
+
+  /**
+   * Specifies the number of used items of ::m_xTransitions.
+   */
+  uint8_t m_nTransitions;
+
+  /**
+   * Specifies the statistics of the tasks.
+   */
+  PMPTaskStats m_xTasks[PMP_CFG_MAX_TASKS];
+
+  /**
+   * Specifies the number of used items of ::m_xTasks.
+   */
+  uint8_t m_nTasks;
+
+  /**
+   * Specifies the statistics of the current transaction pair. It is NULL if all the items of ::m_xTransitions are used.
+   */
+  PMPTransitionStats *m_pxCurrent;
+
+  /**
+   * Specifies the start timestamp of each phase.
+   */
+  uint32_t m_nPhaseStart[E_PMP_PHASE_COUNT];
+
+  /**
+   * Specifies the duration, in us, of each phase accumulated in the current transaction.
+   */
+  uint32_t m_nPhaseDuration[E_PMP_PHASE_COUNT];
+
+  /**
+   * Specifies the start timestamp of each PM class.
+   */
+  uint32_t m_nClassStart[AMT_PM_CLASS_COUNT];
+
+  /**
+   * Specifies the duration, in us, of each PM class in the current transaction.
+   */
+  uint32_t m_nClassDuration[AMT_PM_CLASS_COUNT];
+
+  /**
+   * Specifies the PM class being processed by INIT.
+   */
+  EPMClass m_eCurrentClass;
+
+  /**
+   * Specifies a bit mask. The bit n is set if at least one task of the PM class n did enter the new power mode
+   * in the current transaction. Only these PM classes are added to the statistics.
+   */
+  uint32_t m_nClassInvolved;
+
+  /**
+   * Specifies the start timestamp of the task function.
+   */
+  uint32_t m_nTaskStart;
+};
+
+
+/* Private member function declaration */
+/***************************************/
+
+/**
+ * Add a sample to the statistics of a duration.
+ *
+ * @param pxStats [IN] specifies the statistics of a duration.
+ * @param nDuration [IN] specifies a duration in us.
+ */
+static void PMPStatsAdd(PMPStats *pxStats, uint32_t nDuration);
+
+/**
+ * Print a duration with the system log.
+ *
+ * @param pcName [IN] specifies the name of the duration.
+ * @param pxStats [IN] specifies the statistics of the duration.
+ */
+static void PMPStatsDump(const char *pcName, const PMPStats *pxStats);
+
+
+/**
+ * Name of the phases used by PMPDump().
+ */
+static const char *const s_pcPhaseName[E_PMP_PHASE_COUNT] = {"on_enter", "do_enter", "wait", "did_enter", "resume", "total"};
+
+/**
+ * The only instance of the profiler.
+ */
+static PMProfiler s_xThePMProfiler;
+
+
+/* Public API definition */
+/*************************/
+
+void PMPTransactionBegin(const EPowerMode eFrom, const EPowerMode eTo) {
+  uint8_t i;
+
+  s_xThePMProfiler.m_pxCurrent = NULL;
+  for (i = 0; i < s_xThePMProfiler.m_nTransitions; ++i) {
+    if ((s_xThePMProfiler.m_xTransitions[i].eFrom == eFrom) && (s_xThePMProfiler.m_xTransitions[i].eTo == eTo)) {
+      s_xThePMProfiler.m_pxCurrent = &s_xThePMProfiler.m_xTransitions[i];
+      break;
+    }
+  }
+  if ((s_xThePMProfiler.m_pxCurrent == NULL) && (s_xThePMProfiler.m_nTransitions < PMP_CFG_MAX_TRANSITIONS)) {
+    s_xThePMProfiler.m_pxCurrent = &s_xThePMProfiler.m_xTransitions[s_xThePMProfiler.m_nTransitions++];
+    s_xThePMProfiler.m_pxCurrent->eFrom = eFrom;
+    s_xThePMProfiler.m_pxCurrent->eTo = eTo;
+  }
+
+  (void)memset(s_xThePMProfiler.m_nPhaseDuration, 0, sizeof(s_xThePMProfiler.m_nPhaseDuration));
+  (void)memset(s_xThePMProfiler.m_nClassDuration, 0, sizeof(s_xThePMProfiler.m_nClassDuration));
+  s_xThePMProfiler.m_nClassInvolved = 0;
+  PMPPhaseBegin(E_PMP_PHASE_TOTAL);
+}
+
+void PMPTransactionEnd(void) {
+  PMPTransitionStats *pxCurrent = s_xThePMProfiler.m_pxCurrent;
+  uint32_t nTotalMs;
+  uint8_t nBin = 0;
+
+  PMPPhaseEnd(E_PMP_PHASE_TOTAL);
+
+  if (pxCurrent != NULL) {
+    for (uint8_t i = 0; i < (uint8_t)E_PMP_PHASE_COUNT; ++i) {
+      PMPStatsAdd(&pxCurrent->xPhase[i], s_xThePMProfiler.m_nPhaseDuration[i]);
+    }
+    for (uint8_t i = 0; i < AMT_PM_CLASS_COUNT; ++i) {
+      if ((s_xThePMProfiler.m_nClassInvolved & (1UL << i)) != 0U) {
+        PMPStatsAdd(&pxCurrent->xClass[i], s_xThePMProfiler.m_nClassDuration[i]);
+      }
+    }
+
+    /* the bin n counts the transactions in [2^(n-1), 2^n) ms.*/
+    nTotalMs = s_xThePMProfiler.m_nPhaseDuration[E_PMP_PHASE_TOTAL] / 1000U;
+    while ((nTotalMs != 0U) && (nBin < (PMP_CFG_HISTOGRAM_BINS - 1U))) {
+      nTotalMs >>= 1;
+      nBin++;
+    }
+    pxCurrent->nHistogram[nBin]++;
+  }
+}
+
+void PMPPhaseBegin(const EPMPPhase ePhase) {
+  s_xThePMProfiler.m_nPhaseStart[ePhase] = SysTsGetTimestamp();
+}
+
+void PMPPhaseEnd(const EPMPPhase ePhase) {
+  s_xThePMProfiler.m_nPhaseDuration[ePhase] += SysTsGetElapsedUs(s_xThePMProfiler.m_nPhaseStart[ePhase]);
+}
+
+void PMPClassBegin(const EPMClass ePMClass) {
+  s_xThePMProfiler.m_eCurrentClass = ePMClass;
+  s_xThePMProfiler.m_nClassStart[ePMClass] = SysTsGetTimestamp();
+}
+
+void PMPClassEnd(const EPMClass ePMClass) {
+  s_xThePMProfiler.m_nClassDuration[ePMClass] += SysTsGetElapsedUs(s_xThePMProfiler.m_nClassStart[ePMClass]);
+}
+
+void PMPTaskBegin(void) {
+  s_xThePMProfiler.m_nTaskStart = SysTsGetTimestamp();
+}
+
+void PMPTaskEnd(AManagedTask *pxTask, const EPMPTaskPhase ePhase) {
+  uint32_t nDuration = SysTsGetElapsedUs(s_xThePMProfiler.m_nTaskStart);
+  PMPTaskStats *pxStats = (PMPTaskStats*)PMPGetTaskStats(pxTask);
+
+  if ((pxStats == NULL) && (s_xThePMProfiler.m_nTasks < PMP_CFG_MAX_TASKS)) {
+    pxStats = &s_xThePMProfiler.m_xTasks[s_xThePMProfiler.m_nTasks++];
+    pxStats->pxTask = pxTask;
+  }
+  if (pxStats != NULL) {
+    PMPStatsAdd(&pxStats->xPhase[ePhase], nDuration);
+  }
+  if (ePhase == E_PMP_TASK_PHASE_DO_ENTER) {
+    s_xThePMProfiler.m_nClassInvolved |= 1UL << (uint8_t)s_xThePMProfiler.m_eCurrentClass;
+  }
+}
+
+void PMPOnTaskDeleted(const AManagedTask *pxTask) {
+  uint8_t i;
+
+  for (i = 0; (i < s_xThePMProfiler.m_nTasks) && (s_xThePMProfiler.m_xTasks[i].pxTask != pxTask); ++i) {
+  }
+
+  if (i < s_xThePMProfiler.m_nTasks) {
+    /* PMPDump() can run in another task, so it must never see a deleted task.*/
+    vTaskSuspendAll();
+    s_xThePMProfiler.m_nTasks--;
+    s_xThePMProfiler.m_xTasks[i] = s_xThePMProfiler.m_xTasks[s_xThePMProfiler.m_nTasks];
+    (void)xTaskResumeAll();
+  }
+}
+
+const PMPTransitionStats *PMPGetTransitionStats(const EPowerMode eFrom, const EPowerMode eTo) {
+  const PMPTransitionStats *pxStats = NULL;
+
+  for (uint8_t i = 0; i < s_xThePMProfiler.m_nTransitions; ++i) {
+    if ((s_xThePMProfiler.m_xTransitions[i].eFrom == eFrom) && (s_xThePMProfiler.m_xTransitions[i].eTo == eTo)) {
+      pxStats = &s_xThePMProfiler.m_xTransitions[i];
+      break;
+    }
+  }
+
+  return pxStats;
+}
+
+const PMPTaskStats *PMPGetTaskStats(const AManagedTask *pxTask) {
+  const PMPTaskStats *pxStats = NULL;
+
+  for (uint8_t i = 0; i < s_xThePMProfiler.m_nTasks; ++i) {
+    if (s_xThePMProfiler.m_xTasks[i].pxTask == pxTask) {
+      pxStats = &s_xThePMProfiler.m_xTasks[i];
+      break;
+    }
+  }
+
+  return pxStats;
+}
+
+uint32_t PMPGetMean(const PMPStats *pxStats) {
+  assert_param(pxStats != NULL);
+
+  return pxStats->nCount != 0U ? (uint32_t)(pxStats->nSum / pxStats->nCount) : 0U;
+}
+
+void PMPReset(void) {
+  (void)memset(&s_xThePMProfiler, 0, sizeof(s_xThePMProfiler));
+}
+
+void PMPDump(void) {
+  const PMPTransitionStats *pxTransition;
+  const PMPTaskStats *pxTask;
+  char pcName[12];
+
+  for (uint8_t i = 0; i < s_xThePMProfiler.m_nTransitions; ++i) {
+    pxTransition = &s_xThePMProfiler.m_xTransitions[i];
+    SYS_DEBUGF(SYS_DBG_LEVEL_DEFAULT, ("PMP: %u->%u hist:", (uint8_t)pxTransition->eFrom, (uint8_t)pxTransition->eTo));
+    for (uint8_t j = 0; j < PMP_CFG_HISTOGRAM_BINS; ++j) {
+      SYS_DEBUGF(SYS_DBG_LEVEL_DEFAULT, (" %u", pxTransition->nHistogram[j]));
+    }
+    SYS_DEBUGF(SYS_DBG_LEVEL_DEFAULT, ("\r\n"));
+    for (uint8_t j = 0; j < (uint8_t)E_PMP_PHASE_COUNT; ++j) {
+      PMPStatsDump(s_pcPhaseName[j], &pxTransition->xPhase[j]);
+    }
+    for (uint8_t j = 0; j < AMT_PM_CLASS_COUNT; ++j) {
+      if (pxTransition->xClass[j].nCount != 0U) {
+        (void)snprintf(pcName, sizeof(pcName), "class_%u", j);
+        PMPStatsDump(pcName, &pxTransition->xClass[j]);
+      }
+    }
+  }
+
+  for (uint8_t i = 0; i < s_xThePMProfiler.m_nTasks; ++i) {
+    pxTask = &s_xThePMProfiler.m_xTasks[i];
+    SYS_DEBUGF(SYS_DBG_LEVEL_DEFAULT, ("PMP: task %s\r\n", pcTaskGetName(pxTask->pxTask->m_xTaskHandle)));
+    PMPStatsDump("on_enter", &pxTask->xPhase[E_PMP_TASK_PHASE_ON_ENTER]);
+    PMPStatsDump("do_enter", &pxTask->xPhase[E_PMP_TASK_PHASE_DO_ENTER]);
+  }
+}
+
+
+/* Private function definition */
+/*******************************/
+
+static void PMPStatsAdd(PMPStats *pxStats, uint32_t nDuration) {
+  if ((pxStats->nCount == 0U) || (nDuration < pxStats->nMin)) {
+    pxStats->nMin = nDuration;
+  }
+  if (nDuration > pxStats->nMax) {
+    pxStats->nMax = nDuration;
+  }
+  pxStats->nSum += nDuration;
+  pxStats->nCount++;
+}
+
+static void PMPStatsDump(const char *pcName, const PMPStats *pxStats) {
+  SYS_DEBUGF(SYS_DBG_LEVEL_DEFAULT, ("PMP:  %-9s n=%u min=%u max=%u mean=%u us\r\n", pcName, pxStats->nCount, pxStats->nMin, pxStats->nMax, PMPGetMean(pxStats)));
+}
+
+#endif /* INIT_TASK_CFG_ENABLE_PM_PROFILER */
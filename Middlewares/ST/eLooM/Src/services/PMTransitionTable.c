@@ -0,0 +1,32 @@
+/**
+ ******************************************************************************
+ * @file    PMTransitionTable.c
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Table driven power mode state machine.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+
+#include "services/PMTransitionTable.h"
+
+
+// Inline function forward declaration
+// ***********************************
+
+#if defined (__GNUC__) || defined (__ICCARM__)
+extern EPowerMode PMTTComputeNewPowerMode(const PMTransitionTable *_this, const EPowerMode eFromPowerMode, const SysEvent xEvent);
+extern boolean_t PMTTHasEventSource(const PMTransitionTable *_this, const SysEvent xEvent);
+extern boolean_t PMTTIsTransactionValid(const PMTransitionTable *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
+#endif
@@ -0,0 +1,205 @@
+/**
+ ******************************************************************************
+ * @file    StackGuard.c
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   MPU based stack overflow guard.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+
+#include "services/StackGuard.h"
+
+#if (SYS_CFG_ENABLE_MPU_STACK_GUARD == 1)
+
+#include "services/StackGuardLayout.h"
+#include "services/syseventpool.h"
+#include <string.h>
+
+
+/**
+ * Specifies the size in byte of the guard. It is the minimum size of an MPU region.
+ */
+#define STKG_GUARD_SIZE                       32U
+
+#ifndef STKG_CFG_MPU_ATTR_INDEX
+/**
+ * Specifies the index of the memory attribute (MAIR) used for the guard on the ARMv8-M MPU.
+ */
+#define STKG_CFG_MPU_ATTR_INDEX               7U
+#endif
+
+/**
+ * Marks a valid overflow record.
+ */
+#define STKG_RECORD_MAGIC                     0x5354474BU
+
+#if defined(__ICCARM__)
+#define STKG_NO_INIT                          __no_init
+#else
+/**
+ * Place a variable in the RAM that is not initialized by the startup code, so it is kept across a software reset.
+ * The linker script must place the .noinit section in a NOLOAD region.
+ */
+#define STKG_NO_INIT                          __attribute__((section(".noinit")))
+#endif
+
+/**
+ * Specifies the value used by the kernel to fill the stack of a new task (`tskSTACK_FILL_BYTE` in tasks.c).
+ */
+#define STKG_STACK_FILL_BYTE                  0xA5U
+
+
+/**
+ * Specifies the base address of the guard of the running task.
+ */
+static volatile uint32_t s_nGuardBase = 0;
+
+/**
+ * Specifies the lowest address of the stack of the running task.
+ */
+static volatile uint32_t s_nStackBottom = 0;
+
+/**
+ * Record of the last stack overflow. It is written by the fault handler and read by INIT after the reset.
+ */
+static STKG_NO_INIT struct {
+  /**
+   * Specifies the identity of the task.
+   */
+  SysStackOverflow xInfo;
+
+  /**
+   * Specifies ::STKG_RECORD_MAGIC if the record has not been reported yet.
+   */
+  uint32_t nMagic;
+} s_xLastOverflow;
+
+_Static_assert(sizeof(SysStackOverflow) <= SYS_EVT_POOL_CFG_BLOCK_SIZE, "SysStackOverflow does not fit a block of the event pool");
+
+
+/* Private member function declaration */
+/***************************************/
+
+/**
+ * The FreeRTOS stack overflow hook. It is implemented by the application.
+ */
+extern void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName);
+
+
+/* Public API definition */
+/*************************/
+
+void STKGInit(void) {
+  ARM_MPU_Disable();
+  ARM_MPU_ClrRegion(STKG_CFG_MPU_REGION);
+#if defined(ARM_MPU_ARMV8_H)
+  ARM_MPU_SetMemAttr(STKG_CFG_MPU_ATTR_INDEX, ARM_MPU_ATTR(ARM_MPU_ATTR_MEMORY_(1U, 1U, 1U, 1U), ARM_MPU_ATTR_MEMORY_(1U, 1U, 1U, 1U)));
+#endif
+  /* the default memory map is the background region, so only the guard is protected.*/
+  ARM_MPU_Enable(MPU_CTRL_PRIVDEFENA_Msk);
+  SCB->SHCSR |= SCB_SHCSR_MEMFAULTENA_Msk;
+}
+
+void STKGOnTaskSwitchedIn(const void *pvStackBottom) {
+  uint32_t nBase = (uint32_t)STKGLayoutGetGuardBase((uintptr_t)pvStackBottom, STKG_GUARD_SIZE);
+
+  s_nGuardBase = nBase;
+  s_nStackBottom = (uint32_t)pvStackBottom;
+#if defined(ARM_MPU_ARMV8_H)
+  /* the region is disabled while it is moved, so it never covers the memory between the old and the new guard.*/
+  ARM_MPU_ClrRegion(STKG_CFG_MPU_REGION);
+  ARM_MPU_SetRegion(STKG_CFG_MPU_REGION, ARM_MPU_RBAR(nBase, ARM_MPU_SH_NON, 1U, 0U, 1U),
+      ARM_MPU_RLAR(nBase + STKG_GUARD_SIZE - 1U, STKG_CFG_MPU_ATTR_INDEX));
+#else
+  ARM_MPU_SetRegion(ARM_MPU_RBAR(STKG_CFG_MPU_REGION, nBase),
+      ARM_MPU_RASR(1U, ARM_MPU_AP_NONE, 0U, 0U, 1U, 1U, 0U, ARM_MPU_REGION_SIZE_32B));
+#endif
+  /* the exception return at the end of the context switch synchronizes the new MPU configuration.*/
+}
+
+uint32_t STKGGetFreeStack(void) {
+  const uint8_t *pnStackByte;
+  uint32_t nFree;
+
+  /* the scheduler is suspended, so the guard does not move during the scan.*/
+  vTaskSuspendAll();
+  /* the memory below the end of the guard is free: a write in it is a stack overflow.*/
+  pnStackByte = (const uint8_t*)(s_nGuardBase + STKG_GUARD_SIZE);
+  nFree = (uint32_t)pnStackByte - s_nStackBottom;
+  while (*pnStackByte == STKG_STACK_FILL_BYTE) {
+    pnStackByte++;
+    nFree++;
+  }
+  (void)xTaskResumeAll();
+
+  return nFree / sizeof(StackType_t);
+}
+
+void STKGReportLastOverflow(void) {
+  SysEvent xEvent;
+  SysStackOverflow *pxInfo;
+
+  if (s_xLastOverflow.nMagic == STKG_RECORD_MAGIC) {
+    s_xLastOverflow.nMagic = 0;
+    xEvent.nRawEvent = SYS_ERR_MAKE_EVENT(SYS_ERR_EVT_SRC_STACK_GUARD, SYS_ERR_EVT_PARAM_STACK_OVERFLOW);
+    pxInfo = (SysStackOverflow*)SysEvtPoolAlloc();
+    if (pxInfo != NULL) {
+      *pxInfo = s_xLastOverflow.xInfo;
+      pxInfo->pcTaskName[configMAX_TASK_NAME_LEN - 1U] = '\0';
+      (void)SysEvtAttach(&xEvent, pxInfo);
+    }
+    (void)SysPostErrorEvent(xEvent);
+  }
+}
+
+boolean_t STKGOnMemManageFault(void) {
+  uint32_t nCFSR = SCB->CFSR;
+  uint32_t nFaultAddress = 0;
+  boolean_t bIsOverflow = FALSE;
+  TaskHandle_t xTask;
+  char *pcTaskName;
+
+  if ((nCFSR & SCB_CFSR_MSTKERR_Msk) != 0U) {
+    /* the exception stacking has written in the guard.*/
+    bIsOverflow = TRUE;
+  }
+  else if ((nCFSR & SCB_CFSR_MMARVALID_Msk) != 0U) {
+    nFaultAddress = SCB->MMFAR;
+    bIsOverflow = STKGLayoutIsInGuard(s_nGuardBase, STKG_GUARD_SIZE, nFaultAddress);
+  }
+
+  if (bIsOverflow) {
+    xTask = xTaskGetCurrentTaskHandle();
+    pcTaskName = pcTaskGetName(xTask);
+    /* the fault is managed, so the hook can run without the guard.*/
+    ARM_MPU_ClrRegion(STKG_CFG_MPU_REGION);
+    SCB->CFSR = nCFSR & SCB_CFSR_MEMFAULTSR_Msk;
+
+    /* the queues and the event pool cannot be used in the fault handler, so the overflow is only recorded.
+     INIT reports it to the IApplicationErrorDelegate after the reset (see STKGReportLastOverflow()).*/
+    (void)strncpy(s_xLastOverflow.xInfo.pcTaskName, pcTaskName, configMAX_TASK_NAME_LEN);
+    s_xLastOverflow.xInfo.nFaultAddress = nFaultAddress;
+    s_xLastOverflow.nMagic = STKG_RECORD_MAGIC;
+
+    /* the task cannot continue with a corrupted stack.*/
+    vApplicationStackOverflowHook(xTask, pcTaskName);
+    for (;;) {
+    }
+  }
+
+  return bIsOverflow;
+}
+
+#endif /* SYS_CFG_ENABLE_MPU_STACK_GUARD */
@@ -0,0 +1,127 @@
+/**
+ ******************************************************************************
+ * @file    StackGuardHost.c
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Host build of the stack guard.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+
+#include "services/StackGuardHost.h"
+
+#if defined(STKG_CFG_HOST_BUILD)
+
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+
+/**
+ * Specifies the base address of the guard of the running task, or zero if no guard is placed.
+ */
+static volatile uintptr_t s_nGuardBase = 0;
+
+/**
+ * Specifies the running task.
+ */
+static const void *volatile s_pvTask = NULL;
+
+/**
+ * Specifies the hook called when a fault is a stack overflow.
+ */
+static STKGHostOverflowHook_t s_pfHook = NULL;
+
+
+/* Private member function declaration */
+/***************************************/
+
+/**
+ * `SIGSEGV` handler. It stands in for STKGOnMemManageFault().
+ *
+ * @param nSignal [IN] specifies the signal.
+ * @param pxInfo [IN] specifies the information about the fault.
+ * @param pvContext [IN] not used.
+ */
+static void STKGHostOnFault(int nSignal, siginfo_t *pxInfo, void *pvContext);
+
+
+/* Public API definition */
+/*************************/
+
+int STKGHostInit(STKGHostOverflowHook_t pfHook) {
+  struct sigaction xAction;
+
+  s_pfHook = pfHook;
+  (void)memset(&xAction, 0, sizeof(xAction));
+  xAction.sa_sigaction = STKGHostOnFault;
+  xAction.sa_flags = SA_SIGINFO;
+  (void)sigemptyset(&xAction.sa_mask);
+
+  return sigaction(SIGSEGV, &xAction, NULL);
+}
+
+int STKGHostOnTaskSwitchedIn(const void *pvTask, void *pvStackBottom) {
+  uintptr_t nGuardSize = STKGHostGetGuardSize();
+  uintptr_t nBase = STKGLayoutGetGuardBase((uintptr_t)pvStackBottom, nGuardSize);
+  int nRes = 0;
+
+  /* the old guard is released before the new one is placed, as the MPU region is moved.*/
+  if (s_nGuardBase != 0U) {
+    nRes = mprotect((void*)s_nGuardBase, nGuardSize, PROT_READ | PROT_WRITE);
+    s_nGuardBase = 0;
+  }
+  if (nRes == 0) {
+    nRes = mprotect((void*)nBase, nGuardSize, PROT_NONE);
+    if (nRes == 0) {
+      s_nGuardBase = nBase;
+      s_pvTask = pvTask;
+    }
+  }
+
+  return nRes;
+}
+
+uintptr_t STKGHostGetGuardSize(void) {
+  return (uintptr_t)sysconf(_SC_PAGESIZE);
+}
+
+
+/* Private function definition */
+/*******************************/
+
+static void STKGHostOnFault(int nSignal, siginfo_t *pxInfo, void *pvContext) {
+  uintptr_t nFaultAddress = (uintptr_t)pxInfo->si_addr;
+  uintptr_t nGuardSize = STKGHostGetGuardSize();
+  (void)pvContext;
+
+  if ((s_nGuardBase != 0U) && STKGLayoutIsInGuard(s_nGuardBase, nGuardSize, nFaultAddress)) {
+    /* the fault is managed, so the hook can run without the guard.*/
+    (void)mprotect((void*)s_nGuardBase, nGuardSize, PROT_READ | PROT_WRITE);
+    s_nGuardBase = 0;
+    if (s_pfHook != NULL) {
+      s_pfHook(s_pvTask, nFaultAddress);
+    }
+    /* the task cannot continue with a corrupted stack.*/
+    abort();
+  }
+  else {
+    /* it is not a stack overflow: the fault is raised again with the default action when the handler returns.*/
+    (void)signal(nSignal, SIG_DFL);
+  }
+}
+
+#endif /* STKG_CFG_HOST_BUILD */
@@ -0,0 +1,202 @@
+/**
+ ******************************************************************************
+ * @file    StackMonitor.c
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Monitor of the stack usage of the managed tasks.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+
+#include "services/StackMonitor.h"
+
+#if (INIT_TASK_CFG_ENABLE_STACK_MONITOR == 1)
+
+#include "services/StackGuard.h"
+#include "services/sysdebug.h"
+#include <ctype.h>
+#include <string.h>
+
+
+#define SYS_DEBUGF(level, message)            SYS_DEBUGF3(SYS_DBG_INIT, level, message)
+
+
+/**
+ * Create a type name for _StackMonitor.
+ */
+typedef struct _StackMonitor StackMonitor;
+
+/**
+ * Internal state of the monitor. The tasks are registered only by INIT, but they can be sampled by any task,
+ * so a task is sampled with the scheduler suspended: INIT cannot delete it while its stack is scanned.
+ */
+struct _StackMonitor {
+  /**
+   * Specifies the registered tasks.
+   */
+  STKMTaskInfo m_xTasks[STKM_CFG_MAX_TASKS];
+
+  /**
+   * Specifies the number of used items of ::m_xTasks.
+   */
+  uint8_t m_nTasks;
+};
+
+/**
+ * The only instance of the monitor.
+ */
+static StackMonitor s_xTheStackMonitor;
+
+
+/* Private member function declaration */
+/***************************************/
+
+/**
+ * Get the stack high-water mark of a task.
+ *
+ * @param xTaskHandle [IN] specifies a registered task.
+ * @return the minimum free stack of the task, in word, since the task has been created.
+ */
+static uint32_t STKMGetFreeStack(TaskHandle_t xTaskHandle);
+
+
+/* Public API definition */
+/*************************/
+
+void STKMOnTaskCreated(TaskHandle_t xTaskHandle, uint32_t nStackDepth) {
+  STKMTaskInfo *pxInfo;
+
+  if ((xTaskHandle != NULL) && (s_xTheStackMonitor.m_nTasks < STKM_CFG_MAX_TASKS)) {
+    pxInfo = &s_xTheStackMonitor.m_xTasks[s_xTheStackMonitor.m_nTasks];
+    pxInfo->xTaskHandle = xTaskHandle;
+    pxInfo->nStackDepth = nStackDepth;
+    pxInfo->nMinFree = nStackDepth;
+    s_xTheStackMonitor.m_nTasks++;
+  }
+}
+
+void STKMOnTaskDeleted(TaskHandle_t xTaskHandle) {
+  uint8_t i;
+
+  for (i = 0; (i < s_xTheStackMonitor.m_nTasks) && (s_xTheStackMonitor.m_xTasks[i].xTaskHandle != xTaskHandle); ++i) {
+  }
+
+  if (i < s_xTheStackMonitor.m_nTasks) {
+    /* the sampling can run in another task, so it must never see a deleted task.*/
+    vTaskSuspendAll();
+    s_xTheStackMonitor.m_nTasks--;
+    s_xTheStackMonitor.m_xTasks[i] = s_xTheStackMonitor.m_xTasks[s_xTheStackMonitor.m_nTasks];
+    (void)xTaskResumeAll();
+  }
+}
+
+void STKMSample(void) {
+  STKMTaskInfo *pxInfo;
+  uint32_t nFree;
+
+  for (uint8_t i = 0; i < s_xTheStackMonitor.m_nTasks; ++i) {
+    /* the handle is read and the stack is scanned with the scheduler suspended, so INIT cannot unload the task
+     in the meantime. The interrupts remain enabled during the scan.*/
+    vTaskSuspendAll();
+    if (i < s_xTheStackMonitor.m_nTasks) {
+      pxInfo = &s_xTheStackMonitor.m_xTasks[i];
+      nFree = STKMGetFreeStack(pxInfo->xTaskHandle);
+      if (nFree < pxInfo->nMinFree) {
+        pxInfo->nMinFree = nFree;
+      }
+    }
+    (void)xTaskResumeAll();
+  }
+}
+
+uint8_t STKMGetTaskCount(void) {
+  return s_xTheStackMonitor.m_nTasks;
+}
+
+const STKMTaskInfo *STKMGetTaskInfo(uint8_t nIndex) {
+  return nIndex < s_xTheStackMonitor.m_nTasks ? &s_xTheStackMonitor.m_xTasks[nIndex] : NULL;
+}
+
+uint32_t STKMGetRecommendedDepth(const STKMTaskInfo *pxInfo) {
+  assert_param(pxInfo != NULL);
+  uint32_t nUsed = pxInfo->nStackDepth - pxInfo->nMinFree;
+  uint32_t nMargin = (nUsed * STKM_CFG_MARGIN_PERCENT) / 100U;
+
+  if (nMargin < STKM_CFG_MIN_MARGIN) {
+    nMargin = STKM_CFG_MIN_MARGIN;
+  }
+
+  return (nUsed + nMargin + 7U) & ~7UL;
+}
+
+void STKMDump(boolean_t bConfigHeader) {
+  const STKMTaskInfo *pxInfo;
+  const char *pcName;
+  char pcMacro[configMAX_TASK_NAME_LEN];
+  uint32_t nSavedWords = 0;
+  uint32_t nRecommended;
+  uint8_t j;
+
+  STKMSample();
+
+  for (uint8_t i = 0; i < s_xTheStackMonitor.m_nTasks; ++i) {
+    pxInfo = &s_xTheStackMonitor.m_xTasks[i];
+    nRecommended = STKMGetRecommendedDepth(pxInfo);
+    if (nRecommended < pxInfo->nStackDepth) {
+      nSavedWords += pxInfo->nStackDepth - nRecommended;
+    }
+    SYS_DEBUGF(SYS_DBG_LEVEL_DEFAULT, ("STKM: %-*s depth=%u used=%u recommended=%u%s\r\n", configMAX_TASK_NAME_LEN, pcTaskGetName(pxInfo->xTaskHandle),
+        pxInfo->nStackDepth, pxInfo->nStackDepth - pxInfo->nMinFree, nRecommended, nRecommended > pxInfo->nStackDepth ? " (too small)" : ""));
+  }
+  SYS_DEBUGF(SYS_DBG_LEVEL_DEFAULT, ("STKM: saved %u bytes.\r\n", nSavedWords * sizeof(StackType_t)));
+
+  if (bConfigHeader) {
+    SYS_DEBUGF(SYS_DBG_LEVEL_DEFAULT, ("/* Stack depths generated by STKMDump(). */\r\n"));
+    for (uint8_t i = 0; i < s_xTheStackMonitor.m_nTasks; ++i) {
+      pxInfo = &s_xTheStackMonitor.m_xTasks[i];
+      pcName = pcTaskGetName(pxInfo->xTaskHandle);
+      for (j = 0; (pcName[j] != '\0') && (j < (configMAX_TASK_NAME_LEN - 1U)); ++j) {
+        pcMacro[j] = isalnum((unsigned char)pcName[j]) ? (char)toupper((unsigned char)pcName[j]) : '_';
+      }
+      pcMacro[j] = '\0';
+      /* the INIT stack is configured with INIT_TASK_CFG_STACK_SIZE.*/
+      SYS_DEBUGF(SYS_DBG_LEVEL_DEFAULT, ("#define %s_TASK_CFG_STACK_%s %u\r\n", pcMacro,
+          strcmp(pcName, "INIT") == 0 ? "SIZE" : "DEPTH", STKMGetRecommendedDepth(pxInfo)));
+    }
+  }
+}
+
+
+/* Private function definition */
+/*******************************/
+
+static uint32_t STKMGetFreeStack(TaskHandle_t xTaskHandle) {
+  uint32_t nFree;
+
+#if (SYS_CFG_ENABLE_MPU_STACK_GUARD == 1)
+  if (xTaskHandle == xTaskGetCurrentTaskHandle()) {
+    /* the stack of the running task is protected by the guard, and on the ARMv7-M MPU the guard cannot be read.*/
+    nFree = STKGGetFreeStack();
+  }
+  else {
+    nFree = (uint32_t)uxTaskGetStackHighWaterMark(xTaskHandle);
+  }
+#else
+  nFree = (uint32_t)uxTaskGetStackHighWaterMark(xTaskHandle);
+#endif
+
+  return nFree;
+}
+
+#endif /* INIT_TASK_CFG_ENABLE_STACK_MONITOR */
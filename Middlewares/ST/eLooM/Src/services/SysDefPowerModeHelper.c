@@ -23,6 +23,7 @@
 
 #include "services/SysDefPowerModeHelper.h"
 #include "services/SysDefPowerModeHelper_vtbl.h"
+#include "services/PMTransitionTable.h"
 #include "FreeRTOS.h"
 #include "services/sysinit.h"
 #include "services/sysdebug.h"
@@ -36,6 +37,18 @@
 
 #define SYS_DEBUGF(level, message)      SYS_DEBUGF3(SYS_DBG_APMH, level, message)
 
+/**
+ * Transitions of the default power mode state machine: X(from, event source, event parameter, to).
+ */
+#define SYS_DEF_PM_TRANSITIONS(X) \
+  X(E_POWER_MODE_STATE1,  SYS_PM_EVT_SRC_SW, SYS_PM_EVT_PARAM_ENTER_LP, E_POWER_MODE_SLEEP_1) \
+  X(E_POWER_MODE_SLEEP_1, SYS_PM_EVT_SRC_SW, SYS_PM_EVT_PARAM_EXIT_LP,  E_POWER_MODE_STATE1)
+
+/**
+ * Default power mode state machine.
+ */
+PMTT_DEFINE(s_xSysDefPMTable, 2U, 2U, 3U, SYS_DEF_PM_TRANSITIONS);
+
 
 /**
  * Application Power Mode Helper virtual table.
@@ -47,9 +60,18 @@ static const IAppPowerModeHelper_vtbl s_xSysDefPowerModeHelper_vtbl = {
     SysDefPowerModeHelper_vtblDidEnterPowerMode,
     SysDefPowerModeHelper_vtblGetActivePowerMode,
     SysDefPowerModeHelper_vtblGetPowerStatus,
-    SysDefPowerModeHelper_vtblIsLowPowerMode
+    SysDefPowerModeHelper_vtblIsLowPowerMode,
+    SysDefPowerModeHelper_vtblComputeNewPowerModeFrom,
+    SysDefPowerModeHelper_vtblIsPowerModeTransactionValid
 };
 
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+/**
+ * In static allocation mode the only instance of the class is allocated by the linker.
+ */
+static SysDefPowerModeHelper s_xTheObj;
+#endif
+
 
 /* Private member function declaration */
 /***************************************/
@@ -65,7 +87,11 @@ extern void SystemClock_Restore(void);
 /*************************/
 
 IAppPowerModeHelper *SysDefPowerModeHelperAlloc() {
-  IAppPowerModeHelper *pNewObj = (IAppPowerModeHelper*)pvPortMalloc(sizeof(SysDefPowerModeHelper));
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+  IAppPowerModeHelper *pNewObj = (IAppPowerModeHelper*)SysAlloc(sizeof(SysDefPowerModeHelper));
+#else
+  IAppPowerModeHelper *pNewObj = (IAppPowerModeHelper*)&s_xTheObj;
+#endif
 
   if (pNewObj == NULL) {
     SYS_SET_SERVICE_LEVEL_ERROR_CODE(SYS_OUT_OF_MEMORY_ERROR_CODE);
@@ -95,22 +121,20 @@ EPowerMode SysDefPowerModeHelper_vtblComputeNewPowerMode(IAppPowerModeHelper *th
   assert_param(this);
   SysDefPowerModeHelper *pObj = (SysDefPowerModeHelper*)this;
 
-  EPowerMode ePowerMode = pObj->m_xStatus.m_eActivePowerMode;
-
-  switch (xEvent.xEvent.nSource) {
+  return SysDefPowerModeHelper_vtblComputeNewPowerModeFrom(this, pObj->m_xStatus.m_eActivePowerMode, xEvent);
+}
 
-  case SYS_PM_EVT_SRC_SW:
-    if ((xEvent.xEvent.nParam == SYS_PM_EVT_PARAM_ENTER_LP) && (ePowerMode == E_POWER_MODE_STATE1)) {
-      ePowerMode = E_POWER_MODE_SLEEP_1;
-    }
-    else if ((xEvent.xEvent.nParam == SYS_PM_EVT_PARAM_EXIT_LP) && (ePowerMode == E_POWER_MODE_SLEEP_1)) {
-      ePowerMode = E_POWER_MODE_STATE1;
-    }
-    break;
+EPowerMode SysDefPowerModeHelper_vtblComputeNewPowerModeFrom(IAppPowerModeHelper *this, const EPowerMode eFromPowerMode, const SysEvent xEvent) {
+  assert_param(this);
+  UNUSED(this);
+  EPowerMode ePowerMode = eFromPowerMode;
 
-  default:
+  if (PMTTHasEventSource(&s_xSysDefPMTable, xEvent)) {
+    ePowerMode = PMTTComputeNewPowerMode(&s_xSysDefPMTable, eFromPowerMode, xEvent);
+  }
+  else {
+    /* the event is not part of the power mode state machine.*/
     sys_error_handler();
-    break;
   }
 
   return ePowerMode;
@@ -118,22 +142,7 @@ EPowerMode SysDefPowerModeHelper_vtblComputeNewPowerMode(IAppPowerModeHelper *th
 
 boolean_t SysDefPowerModeHelper_vtblCheckPowerModeTransaction(IAppPowerModeHelper *this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode) {
   UNUSED(this);
-  boolean_t xRes = FALSE;
-
-  switch (eActivePowerMode) {
-  case E_POWER_MODE_STATE1:
-    if (eNewPowerMode == E_POWER_MODE_SLEEP_1) {
-      xRes = TRUE;
-    }
-    break;
-  case E_POWER_MODE_SLEEP_1:
-    if (eNewPowerMode == E_POWER_MODE_STATE1) {
-      xRes = TRUE;
-    }
-    break;
-  default:
-    xRes = FALSE;
-  }
+  boolean_t xRes = PMTTIsTransactionValid(&s_xSysDefPMTable, eActivePowerMode, eNewPowerMode);
 
   if (xRes == FALSE) {
     sys_error_handler();
@@ -144,6 +153,12 @@ boolean_t SysDefPowerModeHelper_vtblCheckPowerModeTransaction(IAppPowerModeHelpe
   return xRes;
 }
 
+boolean_t SysDefPowerModeHelper_vtblIsPowerModeTransactionValid(IAppPowerModeHelper *this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode) {
+  UNUSED(this);
+
+  return PMTTIsTransactionValid(&s_xSysDefPMTable, eActivePowerMode, eNewPowerMode);
+}
+
 #if (SYS_CFG_DEF_PM_HELPER_STANDBY != 1)
 
 //Put the system in STOP1
@@ -0,0 +1,222 @@
+/**
+ ******************************************************************************
+ * @file    SysMemHeap.c
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Heap of a memory region.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+
+#include "services/SysMemHeap.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+
+/**
+ * Specifies the alignment of the blocks.
+ */
+#define SYS_MEM_HEAP_ALIGNMENT                8U
+
+/**
+ * Specifies the size in byte of the header of a block, rounded up to the alignment.
+ */
+#define SYS_MEM_HEAP_HEADER_SIZE              ((sizeof(SysMemHeapBlock) + (SYS_MEM_HEAP_ALIGNMENT - 1U)) & ~(size_t)(SYS_MEM_HEAP_ALIGNMENT - 1U))
+
+/**
+ * Specifies the minimum size of a block. A free block smaller than this is not split.
+ */
+#define SYS_MEM_HEAP_MIN_BLOCK_SIZE           (SYS_MEM_HEAP_HEADER_SIZE * 2U)
+
+/**
+ * Mark of the allocated blocks in the SysMemHeapBlock::nSize field.
+ */
+#define SYS_MEM_HEAP_ALLOCATED_Msk            ((size_t)1 << ((sizeof(size_t) * 8U) - 1U))
+
+
+/* Private member function declaration */
+/***************************************/
+
+/**
+ * Insert a block in the list of the free blocks and merge it with the adjacent free blocks.
+ *
+ * @param _this [IN] specifies a heap object.
+ * @param pxBlock [IN] specifies the block.
+ */
+static void SysMemHeapInsertFreeBlock(SysMemHeap *_this, SysMemHeapBlock *pxBlock);
+
+
+/* Public API definition */
+/*************************/
+
+sys_error_code_t SysMemHeapInit(SysMemHeap *_this, void *pvStart, void *pvEnd) {
+  assert_param(_this != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  uint32_t nStart = ((uint32_t)pvStart + (SYS_MEM_HEAP_ALIGNMENT - 1U)) & ~(SYS_MEM_HEAP_ALIGNMENT - 1U);
+  uint32_t nEnd = (uint32_t)pvEnd & ~(SYS_MEM_HEAP_ALIGNMENT - 1U);
+  SysMemHeapBlock *pxBlock = (SysMemHeapBlock*)nStart;
+
+  if ((nEnd <= nStart) || ((nEnd - nStart) < SYS_MEM_HEAP_MIN_BLOCK_SIZE)) {
+    xRes = SYS_INVALID_PARAMETER_ERROR_CODE;
+    SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+  }
+  else {
+    pxBlock->pxNext = NULL;
+    pxBlock->nSize = nEnd - nStart;
+    _this->m_xFreeList.pxNext = pxBlock;
+    _this->m_xFreeList.nSize = 0;
+    _this->m_pnStart = (uint8_t*)nStart;
+    _this->m_pnEnd = (uint8_t*)nEnd;
+    _this->m_xStats.nSize = pxBlock->nSize;
+    _this->m_xStats.nFreeSize = pxBlock->nSize;
+    _this->m_xStats.nMinFreeSize = pxBlock->nSize;
+    _this->m_xStats.nLargestFreeBlock = pxBlock->nSize;
+    _this->m_xStats.nFreeBlockCount = 1;
+    _this->m_xStats.nAllocatedCount = 0;
+    _this->m_xStats.nFailedCount = 0;
+  }
+
+  return xRes;
+}
+
+void *SysMemHeapAlloc(SysMemHeap *_this, size_t nSize) {
+  assert_param(_this != NULL);
+  void *pvData = NULL;
+  SysMemHeapBlock *pxPrev = &_this->m_xFreeList;
+  SysMemHeapBlock *pxBlock;
+  SysMemHeapBlock *pxNewBlock;
+  size_t nBlockSize = (nSize + SYS_MEM_HEAP_HEADER_SIZE + (SYS_MEM_HEAP_ALIGNMENT - 1U)) & ~(size_t)(SYS_MEM_HEAP_ALIGNMENT - 1U);
+
+  if ((nSize == 0U) || (nSize >= (SYS_MEM_HEAP_ALLOCATED_Msk - SYS_MEM_HEAP_MIN_BLOCK_SIZE))) {
+    nBlockSize = 0;
+  }
+
+  vTaskSuspendAll();
+  if (nBlockSize != 0U) {
+    /* first fit: the free blocks are sorted by address.*/
+    pxBlock = pxPrev->pxNext;
+    while ((pxBlock != NULL) && (pxBlock->nSize < nBlockSize)) {
+      pxPrev = pxBlock;
+      pxBlock = pxBlock->pxNext;
+    }
+
+    if (pxBlock != NULL) {
+      if ((pxBlock->nSize - nBlockSize) >= SYS_MEM_HEAP_MIN_BLOCK_SIZE) {
+        /* the end of the block remains free, in the same position of the list.*/
+        pxNewBlock = (SysMemHeapBlock*)((uint8_t*)pxBlock + nBlockSize);
+        pxNewBlock->nSize = pxBlock->nSize - nBlockSize;
+        pxNewBlock->pxNext = pxBlock->pxNext;
+        pxPrev->pxNext = pxNewBlock;
+        pxBlock->nSize = nBlockSize;
+      }
+      else {
+        pxPrev->pxNext = pxBlock->pxNext;
+      }
+
+      _this->m_xStats.nFreeSize -= pxBlock->nSize;
+      if (_this->m_xStats.nFreeSize < _this->m_xStats.nMinFreeSize) {
+        _this->m_xStats.nMinFreeSize = _this->m_xStats.nFreeSize;
+      }
+      _this->m_xStats.nAllocatedCount++;
+      pxBlock->nSize |= SYS_MEM_HEAP_ALLOCATED_Msk;
+      pxBlock->pxNext = NULL;
+      pvData = (uint8_t*)pxBlock + SYS_MEM_HEAP_HEADER_SIZE;
+    }
+  }
+  if (pvData == NULL) {
+    _this->m_xStats.nFailedCount++;
+  }
+  (void)xTaskResumeAll();
+
+  return pvData;
+}
+
+sys_error_code_t SysMemHeapFree(SysMemHeap *_this, void *pvData) {
+  assert_param(_this != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  SysMemHeapBlock *pxBlock = (SysMemHeapBlock*)((uint8_t*)pvData - SYS_MEM_HEAP_HEADER_SIZE);
+
+  if (!SysMemHeapContains(_this, pvData) || (((uint32_t)pvData & (SYS_MEM_HEAP_ALIGNMENT - 1U)) != 0U)
+      || ((uint8_t*)pxBlock < _this->m_pnStart) || ((pxBlock->nSize & SYS_MEM_HEAP_ALLOCATED_Msk) == 0U)) {
+    xRes = SYS_INVALID_PARAMETER_ERROR_CODE;
+    SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+  }
+  else {
+    vTaskSuspendAll();
+    pxBlock->nSize &= ~SYS_MEM_HEAP_ALLOCATED_Msk;
+    _this->m_xStats.nFreeSize += pxBlock->nSize;
+    _this->m_xStats.nAllocatedCount--;
+    SysMemHeapInsertFreeBlock(_this, pxBlock);
+    (void)xTaskResumeAll();
+  }
+
+  return xRes;
+}
+
+boolean_t SysMemHeapContains(SysMemHeap *_this, const void *pvData) {
+  assert_param(_this != NULL);
+  const uint8_t *pnData = (const uint8_t*)pvData;
+
+  return ((pnData >= _this->m_pnStart) && (pnData < _this->m_pnEnd)) ? TRUE : FALSE;
+}
+
+SysMemHeapStats SysMemHeapGetStats(SysMemHeap *_this) {
+  assert_param(_this != NULL);
+  SysMemHeapStats xStats;
+  SysMemHeapBlock *pxBlock;
+
+  vTaskSuspendAll();
+  xStats = _this->m_xStats;
+  xStats.nLargestFreeBlock = 0;
+  xStats.nFreeBlockCount = 0;
+  for (pxBlock = _this->m_xFreeList.pxNext; pxBlock != NULL; pxBlock = pxBlock->pxNext) {
+    xStats.nFreeBlockCount++;
+    if (pxBlock->nSize > xStats.nLargestFreeBlock) {
+      xStats.nLargestFreeBlock = pxBlock->nSize;
+    }
+  }
+  (void)xTaskResumeAll();
+
+  return xStats;
+}
+
+
+/* Private function definition */
+/*******************************/
+
+static void SysMemHeapInsertFreeBlock(SysMemHeap *_this, SysMemHeapBlock *pxBlock) {
+  SysMemHeapBlock *pxPrev = &_this->m_xFreeList;
+
+  while ((pxPrev->pxNext != NULL) && (pxPrev->pxNext < pxBlock)) {
+    pxPrev = pxPrev->pxNext;
+  }
+
+  /* merge with the next free block.*/
+  if ((pxPrev->pxNext != NULL) && (((uint8_t*)pxBlock + pxBlock->nSize) == (uint8_t*)pxPrev->pxNext)) {
+    pxBlock->nSize += pxPrev->pxNext->nSize;
+    pxBlock->pxNext = pxPrev->pxNext->pxNext;
+  }
+  else {
+    pxBlock->pxNext = pxPrev->pxNext;
+  }
+
+  /* merge with the previous free block. The head of the list has size zero, so it is never merged.*/
+  if ((pxPrev != &_this->m_xFreeList) && (((uint8_t*)pxPrev + pxPrev->nSize) == (uint8_t*)pxBlock)) {
+    pxPrev->nSize += pxBlock->nSize;
+    pxPrev->pxNext = pxBlock->pxNext;
+  }
+  else {
+    pxPrev->pxNext = pxBlock;
+  }
+}
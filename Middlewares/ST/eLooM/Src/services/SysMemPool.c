@@ -0,0 +1,223 @@
+/**
+ ******************************************************************************
+ * @file    SysMemPool.c
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Fixed-block memory pool.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+
+#include "services/SysMemPool.h"
+#include "services/syslowpower.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+
+/* Private member function declaration */
+/***************************************/
+
+/**
+ * Enter a critical section from a task or from an ISR.
+ *
+ * @param bIsFromISR [IN] specifies if the function is called from an ISR.
+ * @return the interrupt status to give to SysMemPoolExitCritical().
+ */
+static inline UBaseType_t SysMemPoolEnterCritical(boolean_t bIsFromISR);
+
+/**
+ * Exit a critical section entered with SysMemPoolEnterCritical().
+ *
+ * @param bIsFromISR [IN] specifies if the function is called from an ISR.
+ * @param uxSavedInterruptStatus [IN] specifies the interrupt status returned by SysMemPoolEnterCritical().
+ */
+static inline void SysMemPoolExitCritical(boolean_t bIsFromISR, UBaseType_t uxSavedInterruptStatus);
+
+#if (SYS_MEM_POOL_CFG_CHECK_OWNERSHIP == 1)
+/**
+ * Check if a block is in the free list. It must be called in a critical section.
+ *
+ * @param _this [IN] specifies a pool object.
+ * @param pvBlock [IN] specifies a block of the pool.
+ * @return `TRUE` if the block is free, `FALSE` otherwise.
+ */
+static boolean_t SysMemPoolIsFree(SysMemPool *_this, const void *pvBlock);
+#endif
+
+
+/* Public API definition */
+/*************************/
+
+sys_error_code_t SysMemPoolInit(SysMemPool *_this, void *pvBuffer, size_t nBlockSize, uint16_t nBlockCount) {
+  assert_param(_this != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  uint8_t *pnBlock = (uint8_t*)pvBuffer;
+
+  if ((pvBuffer == NULL) || (nBlockCount == 0U) || (nBlockSize != SYS_MEM_POOL_BLOCK_SIZE(nBlockSize)) || (nBlockSize > UINT16_MAX)
+      || (((uint32_t)pvBuffer & 7U) != 0U)) {
+    xRes = SYS_INVALID_PARAMETER_ERROR_CODE;
+    SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+  }
+  else {
+    /* link the blocks in address order.*/
+    for (uint16_t i = 0; i < (nBlockCount - 1U); ++i) {
+      *(void**)pnBlock = pnBlock + nBlockSize;
+      pnBlock += nBlockSize;
+    }
+    *(void**)pnBlock = NULL;
+
+    _this->m_pnBlocks = (uint8_t*)pvBuffer;
+    _this->m_pvFreeList = pvBuffer;
+    _this->m_xStats.nBlockSize = (uint16_t)nBlockSize;
+    _this->m_xStats.nBlockCount = nBlockCount;
+    _this->m_xStats.nUsedCount = 0;
+    _this->m_xStats.nMaxUsedCount = 0;
+    _this->m_xStats.nFailedCount = 0;
+  }
+
+  return xRes;
+}
+
+void *SysMemPoolAlloc(SysMemPool *_this) {
+  assert_param(_this != NULL);
+  boolean_t bIsFromISR = SYS_IS_CALLED_FROM_ISR();
+  UBaseType_t uxSavedInterruptStatus = SysMemPoolEnterCritical(bIsFromISR);
+  void *pvBlock = _this->m_pvFreeList;
+
+  if (pvBlock != NULL) {
+    _this->m_pvFreeList = *(void**)pvBlock;
+    if (++_this->m_xStats.nUsedCount > _this->m_xStats.nMaxUsedCount) {
+      _this->m_xStats.nMaxUsedCount = _this->m_xStats.nUsedCount;
+    }
+  }
+  else {
+    _this->m_xStats.nFailedCount++;
+  }
+  SysMemPoolExitCritical(bIsFromISR, uxSavedInterruptStatus);
+
+  return pvBlock;
+}
+
+sys_error_code_t SysMemPoolFree(SysMemPool *_this, void *pvBlock) {
+  assert_param(_this != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  boolean_t bIsFromISR;
+  UBaseType_t uxSavedInterruptStatus;
+
+  if (SysMemPoolGetBlockIndex(_this, pvBlock) >= _this->m_xStats.nBlockCount) {
+    xRes = SYS_INVALID_PARAMETER_ERROR_CODE;
+  }
+  else {
+    bIsFromISR = SYS_IS_CALLED_FROM_ISR();
+    uxSavedInterruptStatus = SysMemPoolEnterCritical(bIsFromISR);
+#if (SYS_MEM_POOL_CFG_CHECK_OWNERSHIP == 1)
+    if ((_this->m_xStats.nUsedCount == 0U) || SysMemPoolIsFree(_this, pvBlock)) {
+      /* the block has been released twice: linking it again would corrupt the free list.*/
+      xRes = SYS_INVALID_PARAMETER_ERROR_CODE;
+    }
+    else
+#endif
+    {
+      *(void**)pvBlock = _this->m_pvFreeList;
+      _this->m_pvFreeList = pvBlock;
+      _this->m_xStats.nUsedCount--;
+    }
+    SysMemPoolExitCritical(bIsFromISR, uxSavedInterruptStatus);
+  }
+
+  if (SYS_IS_ERROR_CODE(xRes)) {
+    SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+  }
+
+  return xRes;
+}
+
+uint16_t SysMemPoolGetBlockIndex(SysMemPool *_this, const void *pvBlock) {
+  assert_param(_this != NULL);
+  uint16_t nIndex = _this->m_xStats.nBlockCount;
+  uint32_t nOffset;
+
+  if (SysMemPoolContains(_this, pvBlock)) {
+    nOffset = (uint32_t)((const uint8_t*)pvBlock - _this->m_pnBlocks);
+    if ((nOffset % _this->m_xStats.nBlockSize) == 0U) {
+      nIndex = (uint16_t)(nOffset / _this->m_xStats.nBlockSize);
+    }
+  }
+
+  return nIndex;
+}
+
+void *SysMemPoolGetBlock(SysMemPool *_this, uint16_t nIndex) {
+  assert_param(_this != NULL);
+
+  return nIndex < _this->m_xStats.nBlockCount ? _this->m_pnBlocks + ((uint32_t)nIndex * _this->m_xStats.nBlockSize) : NULL;
+}
+
+boolean_t SysMemPoolContains(SysMemPool *_this, const void *pvBlock) {
+  assert_param(_this != NULL);
+  const uint8_t *pnBlock = (const uint8_t*)pvBlock;
+  const uint8_t *pnEnd = _this->m_pnBlocks + ((uint32_t)_this->m_xStats.nBlockSize * _this->m_xStats.nBlockCount);
+
+  return ((pnBlock >= _this->m_pnBlocks) && (pnBlock < pnEnd)) ? TRUE : FALSE;
+}
+
+SysMemPoolStats SysMemPoolGetStats(SysMemPool *_this) {
+  assert_param(_this != NULL);
+  SysMemPoolStats xStats;
+  boolean_t bIsFromISR = SYS_IS_CALLED_FROM_ISR();
+  UBaseType_t uxSavedInterruptStatus = SysMemPoolEnterCritical(bIsFromISR);
+
+  xStats = _this->m_xStats;
+  SysMemPoolExitCritical(bIsFromISR, uxSavedInterruptStatus);
+
+  return xStats;
+}
+
+
+/* Private function definition */
+/*******************************/
+
+static inline UBaseType_t SysMemPoolEnterCritical(boolean_t bIsFromISR) {
+  UBaseType_t uxSavedInterruptStatus = 0;
+
+  if (bIsFromISR) {
+    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+  }
+  else {
+    taskENTER_CRITICAL();
+  }
+
+  return uxSavedInterruptStatus;
+}
+
+static inline void SysMemPoolExitCritical(boolean_t bIsFromISR, UBaseType_t uxSavedInterruptStatus) {
+  if (bIsFromISR) {
+    taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptStatus);
+  }
+  else {
+    taskEXIT_CRITICAL();
+  }
+}
+
+#if (SYS_MEM_POOL_CFG_CHECK_OWNERSHIP == 1)
+static boolean_t SysMemPoolIsFree(SysMemPool *_this, const void *pvBlock) {
+  const void *pvFree = _this->m_pvFreeList;
+
+  while ((pvFree != NULL) && (pvFree != pvBlock)) {
+    pvFree = *(void *const*)pvFree;
+  }
+
+  return (pvFree != NULL) ? TRUE : FALSE;
+}
+#endif
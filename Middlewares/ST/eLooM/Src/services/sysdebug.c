@@ -55,6 +55,13 @@ uint8_t g_sys_dbg_min_level = SYS_DBG_LEVEL;
 
 static SemaphoreHandle_t s_xMutex = NULL;
 
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+/**
+ * In static allocation mode the mutex is allocated by the linker.
+ */
+static StaticSemaphore_t s_xMutexBuffer;
+#endif
+
 uint32_t g_ulHighFrequencyTimerTicks = 0;
 
 static void SysDebugSetupRunTimeStatsTimer(void);
@@ -76,7 +83,11 @@ int SysDebugInit() {
   SysDebugHardwareInit();
 
   // software initialization.
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
   s_xMutex = xSemaphoreCreateMutex();
+#else
+  s_xMutex = xSemaphoreCreateMutexStatic(&s_xMutexBuffer);
+#endif
 
   if (s_xMutex == NULL) {
     return 1;
@@ -0,0 +1,87 @@
+/**
+ ******************************************************************************
+ * @file    syseventpool.c
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Pool of the system event attachments.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+
+#include "services/syseventpool.h"
+#include "services/SysMemPool.h"
+
+
+/**
+ * The only instance of the pool. The blocks are aligned to 8 bytes.
+ */
+SYS_MEM_POOL_DEFINE(s_xTheEvtPool, SYS_EVT_POOL_CFG_BLOCK_SIZE, SYS_EVT_POOL_CFG_BLOCK_COUNT);
+
+
+/* Public API definition */
+/*************************/
+
+void SysEvtPoolInit(void) {
+  (void)SYS_MEM_POOL_INIT(s_xTheEvtPool, SYS_EVT_POOL_CFG_BLOCK_SIZE, SYS_EVT_POOL_CFG_BLOCK_COUNT);
+}
+
+void *SysEvtPoolAlloc(void) {
+  return SysMemPoolAlloc(&s_xTheEvtPool);
+}
+
+void SysEvtPoolFree(void *pvBlock) {
+  (void)SysMemPoolFree(&s_xTheEvtPool, pvBlock);
+}
+
+sys_error_code_t SysEvtAttach(SysEvent *pxEvent, void *pvBlock) {
+  assert_param(pxEvent != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  uint16_t nIdx = SysMemPoolGetBlockIndex(&s_xTheEvtPool, pvBlock);
+
+  if (nIdx < SYS_EVT_POOL_CFG_BLOCK_COUNT) {
+    pxEvent->xEvent.nAttachment = nIdx + 1U;
+  }
+  else {
+    xRes = SYS_INVALID_PARAMETER_ERROR_CODE;
+  }
+
+  return xRes;
+}
+
+const void *SysEvtGetAttachment(const SysEvent xEvent) {
+  const void *pvBlock = NULL;
+
+  if (xEvent.xEvent.nAttachment != SYS_EVT_ATTACHMENT_NONE) {
+    pvBlock = SysMemPoolGetBlock(&s_xTheEvtPool, (uint16_t)(xEvent.xEvent.nAttachment - 1U));
+  }
+
+  return pvBlock;
+}
+
+void SysEvtRelease(const SysEvent xEvent) {
+  void *pvBlock;
+
+  if (xEvent.xEvent.nAttachment != SYS_EVT_ATTACHMENT_NONE) {
+    pvBlock = SysMemPoolGetBlock(&s_xTheEvtPool, (uint16_t)(xEvent.xEvent.nAttachment - 1U));
+    if (pvBlock != NULL) {
+      (void)SysMemPoolFree(&s_xTheEvtPool, pvBlock);
+    }
+  }
+}
+
+uint8_t SysEvtPoolGetFreeCount(void) {
+  SysMemPoolStats xStats = SysMemPoolGetStats(&s_xTheEvtPool);
+
+  return (uint8_t)(xStats.nBlockCount - xStats.nUsedCount);
+}
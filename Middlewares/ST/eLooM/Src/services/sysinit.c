@@ -24,6 +24,9 @@
 #include "services/sysdebug.h"
 #include "services/NullErrorDelegate.h"
 #include "services/SysDefPowerModeHelper.h"
+#include "services/PMProfiler.h"
+#include "services/StackMonitor.h"
+#include "services/StackGuard.h"
 #include "FreeRTOS.h"
 #include "task.h"
 #include "queue.h"
@@ -37,16 +40,205 @@
 #ifndef INIT_TASK_CFG_QUEUE_LENGTH
 #define INIT_TASK_CFG_QUEUE_LENGTH             16
 #endif
+#ifndef INIT_TASK_CFG_ERR_QUEUE_LENGTH
+#define INIT_TASK_CFG_ERR_QUEUE_LENGTH         4
+#endif
+#ifndef INIT_TASK_CFG_TASK_REQ_QUEUE_LENGTH
+#define INIT_TASK_CFG_TASK_REQ_QUEUE_LENGTH    4
+#endif
+#ifndef INIT_TASK_CFG_PM_SWITCH_DELAY_MS
 #define INIT_TASK_CFG_PM_SWITCH_DELAY_MS       50
+#endif
+#ifndef INIT_TASK_CFG_PM_SWITCH_DEADLINE_MS
+#define INIT_TASK_CFG_PM_SWITCH_DEADLINE_MS    1000U
+#endif
+#ifndef INIT_TASK_CFG_PM_FOLD_MAX_EVENTS
+#define INIT_TASK_CFG_PM_FOLD_MAX_EVENTS       8U
+#endif
+#ifndef INIT_TASK_CFG_MAX_LATE_TASKS
+#define INIT_TASK_CFG_MAX_LATE_TASKS           4U
+#endif
+#ifndef INIT_TASK_CFG_MAX_BROKEN_PM_DEPENDENCIES
+#define INIT_TASK_CFG_MAX_BROKEN_PM_DEPENDENCIES  4U
+#endif
+
+/**
+ * Specifies the number of power mode event sources. It is given by the size of the SysEvent::nSource field.
+ */
+#define INIT_PM_EVT_SRC_COUNT                  8U
+
+#ifndef INIT_TASK_CFG_ISR_RING_LENGTH
+#define INIT_TASK_CFG_ISR_RING_LENGTH          8U
+#endif
+
+#if ((INIT_TASK_CFG_ISR_RING_LENGTH & (INIT_TASK_CFG_ISR_RING_LENGTH - 1U)) != 0U) || (INIT_TASK_CFG_ISR_RING_LENGTH == 0U)
+#error INIT_TASK_CFG_ISR_RING_LENGTH must be a power of 2
+#endif
+
+/**
+ * Notification bit used by a managed task to wake up INIT when it is ready for a power mode switch.
+ */
+#define INIT_TASK_NOTIFY_PM_SWITCH_READY       0x00000001U
+
+/**
+ * Notification bit used to wake up INIT when a new system event has been posted.
+ */
+#define INIT_TASK_NOTIFY_SYS_EVENT             0x00000002U
+
+/* INIT waits for the system events and for the power mode switch of the tasks on its task notification,
+ so the notifications are a requirement of the port.*/
+#if (configUSE_TASK_NOTIFICATIONS != 1)
+#error The INIT task requires configUSE_TASK_NOTIFICATIONS = 1
+#endif
+
+/* The ISR ring of the event lanes is lock free on the cores that support the exclusive access instructions.*/
+#if defined(__CORTEX_M) && (__CORTEX_M >= 3U)
+#define INIT_RING_USE_EXCLUSIVE_ACCESS         1
+#else
+#define INIT_RING_USE_EXCLUSIVE_ACCESS         0
+#endif
+
+/**
+ * Check if the sequence number (see SysEvent::nSeq) of an event of a lane is before the one of another event.
+ * It is correct as long as the pending events in the lane are less than 2^15.
+ */
+#define INIT_EVT_SEQ_IS_BEFORE(nSeqA, nSeqB)    ((int16_t)(uint16_t)((nSeqA) - (nSeqB)) < 0)
 
 #ifndef INIT_TASK_CFG_ENABLE_BOOT_IF
 #define INIT_TASK_CFG_ENABLE_BOOT_IF           0
 #endif
 
 #define INIT_IS_KIND_OF_AMTEX(pTask)            ((pTask)->m_xStatus.nReserved == 1)
+#define INIT_CAN_FOLD_PM_EVENTS()               ((s_xTheSystem.m_pxAppPowerModeHelper->vptr->ComputeNewPowerModeFrom != NULL) && \
+                                                 (s_xTheSystem.m_pxAppPowerModeHelper->vptr->IsPowerModeTransactionValid != NULL))
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+#define INIT_FREE_HEAP_SIZE()                   xPortGetFreeHeapSize()
+#else
+/* in static allocation mode there is no FreeRTOS heap.*/
+#define INIT_FREE_HEAP_SIZE()                   0U
+#endif
 
 #define SYS_DEBUGF(level, message) 			        SYS_DEBUGF3(SYS_DBG_INIT, level, message)
 
+/**
+ * Create a type name for _SysEventRing.
+ */
+typedef struct _SysEventRing SysEventRing;
+
+/**
+ * Lock-free ring of system events. The producers are the ISRs, the consumer is the INIT task.
+ */
+struct _SysEventRing {
+  /**
+   * Specifies the items of the ring.
+   */
+  SysEvent m_xItems[INIT_TASK_CFG_ISR_RING_LENGTH];
+
+  /**
+   * Specifies, for each item of the ring, if the event has been written by the producer.
+   */
+  volatile uint8_t m_nReady[INIT_TASK_CFG_ISR_RING_LENGTH];
+
+  /**
+   * Specifies the free running index of the next item reserved by a producer.
+   */
+  volatile uint32_t m_nHead;
+
+  /**
+   * Specifies the free running index of the next item read by INIT.
+   */
+  volatile uint32_t m_nTail;
+};
+
+/**
+ * Create a type name for _SysEventLane.
+ */
+typedef struct _SysEventLane SysEventLane;
+
+/**
+ * A lane serializes one kind of system events (see ::ESysEventLane). The events posted by the tasks
+ * go in the queue, the events posted by an ISR go in the ring.
+ */
+struct _SysEventLane {
+  /**
+   * Specifies the queue for the events posted by the tasks.
+   */
+  QueueHandle_t m_xQueue;
+
+  /**
+   * Specifies the ring for the events posted by an ISR.
+   */
+  SysEventRing m_xRing;
+
+  /**
+   * Specifies the statistics of the lane.
+   */
+  SysEventLaneStats m_xStats;
+
+  /**
+   * Specifies the sequence number of the next event posted in the lane. INIT merges the ring and the queue
+   * in the order of the sequence numbers, so the events of the lane are served in the order they have been posted.
+   */
+  volatile uint32_t m_nNextSeq;
+};
+
+/**
+ * Specifies the operation requested to INIT with a ::SysTaskRequest.
+ */
+typedef enum _ESysTaskRequestOp {
+  E_SYS_TASK_REQ_LOAD         = 0,  ///< Load a managed task (see SysLoadTask()).
+  E_SYS_TASK_REQ_UNLOAD       = 1,  ///< Unload a managed task (see SysUnloadTask()).
+  E_SYS_TASK_REQ_SET_PM_CLASS = 2   ///< Move a managed task in a new PM class (see SysSetTaskPMClass()).
+} ESysTaskRequestOp;
+
+/**
+ * Create a type name for _SysTaskRequest.
+ */
+typedef struct _SysTaskRequest SysTaskRequest;
+
+/**
+ * A request to load or to unload a managed task at runtime, or to change its PM class.
+ */
+struct _SysTaskRequest {
+  /**
+   * Specifies the task.
+   */
+  AManagedTask *pxTask;
+
+  /**
+   * Specifies the function called by INIT when the request has been served, or NULL.
+   */
+  pSysTaskRequestDoneFunc_t pfDone;
+
+  /**
+   * Specifies the operation.
+   */
+  ESysTaskRequestOp eOp;
+
+  /**
+   * Specifies the new PM class of the task for a ::E_SYS_TASK_REQ_SET_PM_CLASS request.
+   */
+  EPMClass ePMClass;
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+  /**
+   * Specifies the stack of the task to load, or NULL if the task is created with `xTaskCreate()`.
+   */
+  StackType_t *pxStack;
+
+  /**
+   * Specifies the TCB of the task to load, or NULL if the task is created with `xTaskCreate()`.
+   */
+  StaticTask_t *pxTCB;
+
+  /**
+   * Specifies the depth, in word, of ::pxStack.
+   */
+  uint16_t nStackDepth;
+#endif
+};
+
 /**
  * Create a type name for _System.
  */
@@ -62,12 +254,18 @@ struct _System{
   TaskHandle_t m_xInitTask;
 
   /**
-   * Specifies the queue used to serialize the system request made by the application tasks.
+   * Specifies the lanes used to serialize the system request made by the application.
    * The supported requests are:
+   * - Error, served first.
    * - Power Mode Switch.
-   * - Error.
    */
-  QueueHandle_t m_xSysQueue;
+  SysEventLane m_xEventLane[SYS_EVT_LANE_COUNT];
+
+  /**
+   * Specifies the queue of the requests to load or to unload a managed task. INIT serves them
+   * when there are no system events pending.
+   */
+  QueueHandle_t m_xTaskRequestQueue;
 
   /**
    * Specifies the application specific error manager delegate object.
@@ -79,6 +277,50 @@ struct _System{
    */
   IAppPowerModeHelper *m_pxAppPowerModeHelper;
 
+  /**
+   * Specifies the duration, in RTOS ticks, of the last power mode transaction. It is measured
+   * from the moment INIT starts the transaction until all managed tasks did the DoEnterPowerMode.
+   */
+  uint32_t m_nPMSwitchLatency;
+
+  /**
+   * Specifies the deadline, in ms, of a power mode transaction. Zero means no deadline.
+   */
+  uint32_t m_nPMSwitchDeadlineMs;
+
+  /**
+   * Specifies, for each event source, the last power mode event posted with SysPostPowerModeEventReplace().
+   */
+  SysEvent m_xPMEventSlot[INIT_PM_EVT_SRC_COUNT];
+
+  /**
+   * Specifies a bit mask. The bit n is set if the event in ::m_xPMEventSlot[n] is still in the system queue.
+   */
+  uint32_t m_nPMEventSlotPending;
+
+  /**
+   * Specifies the tasks that missed the deadline of a power mode transaction. A late task is left out of the
+   * transactions, with the power mode switch still pending, until it is ready (see InitTaskCompleteLateTasks()).
+   * When the list is full a task skips the transaction (see ::m_nPMSwitchSkipCount).
+   */
+  AManagedTask *m_pxLateTask[INIT_TASK_CFG_MAX_LATE_TASKS];
+
+  /**
+   * Specifies, for each late task, the last power mode entered by the task.
+   */
+  EPowerMode m_eLateTaskPowerMode[INIT_TASK_CFG_MAX_LATE_TASKS];
+
+  /**
+   * Specifies the number of used items of ::m_pxLateTask.
+   */
+  uint8_t m_nLateTasks;
+
+  /**
+   * Specifies the number of tasks that missed the deadline when ::m_pxLateTask was full. Such a task skips the
+   * transaction: it does not enter the new power mode and it keeps running.
+   */
+  uint32_t m_nPMSwitchSkipCount;
+
 #if INIT_TASK_CFG_ENABLE_BOOT_IF == 1
   /**
    * Specifies the application specific boot interface object.
@@ -102,9 +344,24 @@ struct _System{
 /**
  * The only instance of System object.
  */
-static System s_xTheSystem;
+static System s_xTheSystem = {
+    .m_nPMSwitchDeadlineMs = INIT_TASK_CFG_PM_SWITCH_DEADLINE_MS
+};
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+/**
+ * In static allocation mode the memory of INIT and of its queues is allocated by the linker.
+ */
+static StackType_t s_xInitTaskStack[INIT_TASK_CFG_STACK_SIZE];
+static StaticTask_t s_xInitTaskTCB;
+static uint8_t s_pnErrLaneStorage[INIT_TASK_CFG_ERR_QUEUE_LENGTH * INIT_TASK_CFG_QUEUE_ITEM_SIZE];
+static uint8_t s_pnPMLaneStorage[INIT_TASK_CFG_QUEUE_LENGTH * INIT_TASK_CFG_QUEUE_ITEM_SIZE];
+static StaticQueue_t s_xLaneQueueBuffer[SYS_EVT_LANE_COUNT];
+static uint8_t s_pnTaskRequestStorage[INIT_TASK_CFG_TASK_REQ_QUEUE_LENGTH * sizeof(SysTaskRequest)];
+static StaticQueue_t s_xTaskRequestQueueBuffer;
+#endif
 
-#if( configAPPLICATION_ALLOCATED_HEAP == 1 )
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1) && (configAPPLICATION_ALLOCATED_HEAP == 1)
 /**
  * The FreeRTOS HEAP is allocated by the application so the system can initialize the heap memory at startup
  * in order to prevent some SRAM retention strange issue.
@@ -135,14 +392,282 @@ static void InitTaskRun(void *pParams);
 
 /**
  * Execute the power mode transaction for all managed tasks belonging to a given PMClass.
+ * A task that is not affected by the transaction (see AMTIsPowerModeSwitchRequired()) is skipped.
+ * The tasks of the class are processed as a wavefront: a task does the transaction as soon as all its
+ * dependencies (see AMTExSetPMDependencies()) did it.
  *
  * @param pxContext [IN] specifies the Application Context.
  * @param ePowerModeClass [IN] specifies the a power mode class.
  * @param eActivePowerMode [IN] specifies the current power mode of the system.
  * @param eNewPowerMode [IN] specifies the new power mode that is to be activated by the system.
- * @return the number of tasks that did the PM transaction.
+ * @param xStartTick [IN] specifies the tick count when the transaction started.
+ * @param xDeadlineTicks [IN] specifies the deadline of the transaction, or portMAX_DELAY if the transaction has no deadline.
+ *                            The tasks not ready at the deadline are reported with InitTaskReportDeadlineMiss() and left
+ *                            out of the transaction (see InitTaskAddLateTask()). The deadline is checked every
+ *                            ::INIT_TASK_CFG_PM_SWITCH_DELAY_MS ms.
+ * @return the number of tasks that did, or skipped, the PM transaction.
+ */
+static uint16_t InitTaskDoEnterPowerModeForPMClass(ApplicationContext *pxContext, EPMClass ePowerModeClass, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode, TickType_t xStartTick, TickType_t xDeadlineTicks);
+
+/**
+ * Report to the IApplicationErrorDelegate a task that missed the deadline of a power mode transaction.
+ *
+ * @param pxContext [IN] specifies the Application Context.
+ * @param pxTask [IN] specifies the task that missed the deadline.
+ * @param eActivePowerMode [IN] specifies the current power mode of the system.
+ * @param eNewPowerMode [IN] specifies the new power mode that is to be activated by the system.
+ * @param bIsSkipped [IN] `TRUE` if the task skips the transaction because the list of the late tasks is full.
+ */
+static void InitTaskReportDeadlineMiss(ApplicationContext *pxContext, AManagedTask *pxTask, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode, boolean_t bIsSkipped);
+
+/**
+ * Get the first PM dependency of a task that did not do the power mode transaction yet.
+ *
+ * @param pxTaskEx [IN] specifies a managed task.
+ * @param eActivePowerMode [IN] specifies the current power mode of the system.
+ * @param eNewPowerMode [IN] specifies the new power mode that is to be activated by the system.
+ * @param pxBroken [IN] specifies the PM dependencies ignored in this transaction.
+ * @param nBroken [IN] specifies the number of items in pxBroken.
+ * @return the dependency, or NULL if all the dependencies of the task are done.
+ */
+static AManagedTask *InitTaskGetPendingPMDependency(AManagedTaskEx *pxTaskEx, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode, const SysPMDependencyBreak *pxBroken, uint8_t nBroken);
+
+/**
+ * Find the PM dependency that blocks a PM class, when all the tasks of the class that did not do the transaction
+ * wait for a dependency. Starting from one of these tasks INIT follows the pending dependencies: the offending
+ * dependency is the first one that leaves the class, or, after as many steps as the tasks in the class,
+ * a dependency of the cycle.
+ *
+ * @param pxContext [IN] specifies the Application Context.
+ * @param ePowerModeClass [IN] specifies the PM class.
+ * @param eActivePowerMode [IN] specifies the current power mode of the system.
+ * @param eNewPowerMode [IN] specifies the new power mode that is to be activated by the system.
+ * @param pxBroken [IN] specifies the PM dependencies ignored in this transaction.
+ * @param nBroken [IN] specifies the number of items in pxBroken.
+ * @param pxDependency [OUT] specifies the offending dependency.
+ * @return `TRUE` if success, `FALSE` if no task of the class is waiting for a dependency.
+ */
+static boolean_t InitTaskFindOffendingPMDependency(ApplicationContext *pxContext, EPMClass ePowerModeClass, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode,
+    const SysPMDependencyBreak *pxBroken, uint8_t nBroken, SysPMDependencyBreak *pxDependency);
+
+/**
+ * Report to the IApplicationErrorDelegate a PM dependency that is ignored in a power mode transaction.
+ *
+ * @param pxContext [IN] specifies the Application Context.
+ * @param pxDependency [IN] specifies the dependency.
+ */
+static void InitTaskReportPMDependencyBreak(ApplicationContext *pxContext, const SysPMDependencyBreak *pxDependency);
+
+/**
+ * Check if a managed task has a step function in its current power mode. A task without a step function is
+ * waiting to be resumed (see AMTWaitStepFunction()), so INIT does not resume it at the end of a power mode transaction.
+ *
+ * @param pxTask [IN] specifies a managed task.
+ * @return `TRUE` if the task has a step function in its current power mode, `FALSE` otherwise.
+ */
+static boolean_t InitTaskHasStepFunction(AManagedTask *pxTask);
+
+/**
+ * Add a task that missed the deadline of a power mode transaction to the list of the late tasks.
+ *
+ * @param pxTask [IN] specifies a managed task with the power mode switch pending.
+ * @param eActivePowerMode [IN] specifies the last power mode entered by the task.
+ * @return `TRUE` if the task has been added, `FALSE` if the list is full.
+ */
+static boolean_t InitTaskAddLateTask(AManagedTask *pxTask, const EPowerMode eActivePowerMode);
+
+/**
+ * Look for a task in the list of the late tasks.
+ *
+ * @param pxTask [IN] specifies a managed task.
+ * @return the index of the task in the list, or the number of late tasks if the task is not late.
+ */
+static uint8_t InitTaskFindLateTask(const AManagedTask *pxTask);
+
+/**
+ * Remove a task from the list of the late tasks.
+ *
+ * @param nIdx [IN] specifies the index of the task in the list.
+ */
+static void InitTaskRemoveLateTask(uint8_t nIdx);
+
+/**
+ * Complete the power mode switch of the late tasks that are now ready: each task does the DoEnterPowerMode
+ * from the last power mode it entered to the active power mode of the system, and then it is resumed.
+ * If the transaction from the last power mode of the task to the active power mode is not valid
+ * (see IapmhIsPowerModeTransactionValid()) the task stays late until the system enters a power mode that is.
+ *
+ * @return `TRUE` if at least one task has been completed, `FALSE` otherwise.
+ */
+static boolean_t InitTaskCompleteLateTasks(void);
+
+/**
+ * Execute a power mode transaction: all managed tasks affected by the transaction do the DoEnterPowerMode,
+ * then the system enter the new power mode and the managed tasks are resumed.
+ *
+ * @param pxContext [IN] specifies the Application Context.
+ * @param eActivePowerMode [IN] specifies the current power mode of the system.
+ * @param ePowerMode [IN] specifies the new power mode that is to be activated by the system.
+ */
+static void InitTaskDoPowerModeTransaction(ApplicationContext *pxContext, const EPowerMode eActivePowerMode, const EPowerMode ePowerMode);
+
+/**
+ * Drain the power mode events pending in the system queue and fold them in the target power mode, so that
+ * INIT executes only one transaction from the active power mode to the target power mode. The intermediate
+ * power modes are never entered, and if the events bring the system back to the active power mode there is
+ * no transaction at all. Each step of the folding is validated with IapmhCheckPowerModeTransaction().
+ * The folding stops at the first error event, or after ::INIT_TASK_CFG_PM_FOLD_MAX_EVENTS events.
+ * A sequence of legal steps can fold in a transaction that is not legal, for example SLEEP_1 -> STATE1 -> TEST
+ * when SLEEP_1 -> TEST is not in the state machine. So each folded target is validated against the active power mode
+ * with IapmhIsPowerModeTransactionValid(), and the folding stops at the last legal target: the next power mode
+ * is returned in peNextPowerMode and INIT enters it with a second transaction.
+ *
+ * @param xEvent [IN] specifies the power mode event received by INIT.
+ * @param eActivePowerMode [IN] specifies the current power mode of the system.
+ * @param peNextPowerMode [OUT] specifies the power mode to enter after the target power mode. It is equal to the
+ *        target power mode if the folded transaction is legal.
+ * @return the target power mode.
+ */
+static EPowerMode InitTaskFoldPowerModeEvents(SysEvent xEvent, const EPowerMode eActivePowerMode, EPowerMode *peNextPowerMode);
+
+/**
+ * Get the actual power mode event. If the event has been posted with SysPostPowerModeEventReplace(), then
+ * the last value posted for the same source is returned.
+ *
+ * @param xEvent [IN] specifies a power mode event received from the system queue.
+ * @return the power mode event to be processed.
+ */
+static SysEvent InitTaskTakePowerModeEvent(SysEvent xEvent);
+
+/**
+ * Get the next system event. The events are served in order from:
+ * - the error lane, so the fault response time does not depend on the power mode events.
+ * - the power mode lane.
+ * Inside a lane the events are served in the order they have been posted, from the ISR ring or from the queue.
+ *
+ * @param pxEvent [OUT] specifies the next event.
+ * @param bRemove [IN] if `TRUE` the event is removed, otherwise it remains the next event.
+ * @return `TRUE` if there is a pending event, `FALSE` otherwise.
+ */
+static boolean_t InitTaskGetEvent(SysEvent *pxEvent, boolean_t bRemove);
+
+/**
+ * Get the next event of a lane. The heads of the ISR ring and of the queue are merged by sequence number
+ * (see SysEvent::nSeq).
+ *
+ * @param pxLane [IN] specifies a lane.
+ * @param pxEvent [OUT] specifies the next event.
+ * @param bRemove [IN] if `TRUE` the event is removed, otherwise it remains the next event.
+ * @return `TRUE` if there is a pending event, `FALSE` otherwise.
+ */
+static boolean_t InitTaskLaneGetEvent(SysEventLane *pxLane, SysEvent *pxEvent, boolean_t bRemove);
+
+/**
+ * Process all the pending error events. It is used also during a power mode transaction, so an error is not
+ * delayed by a task that is slow to enter the new power mode.
+ *
+ * @param pxContext [IN] specifies the Application Context.
+ */
+static void InitTaskProcessErrorEvents(ApplicationContext *pxContext);
+
+/**
+ * Load the application context from the manifest of the application. The tasks are added in the order of the manifest.
+ *
+ * @param pxContext [IN] specifies the Application Context.
+ * @param pxManifest [IN] specifies the first entry of the manifest.
+ * @param nTaskCount [IN] specifies the number of entries of the manifest.
+ * @return SYS_NO_ERROR_CODE if success, SYS_OUT_OF_MEMORY_ERROR_CODE if a task object cannot be allocated.
+ */
+static sys_error_code_t InitTaskLoadManifest(ApplicationContext *pxContext, const SysAppTaskEntry *pxManifest, uint8_t nTaskCount);
+
+/**
+ * Block INIT until a new system event, or a request to load or unload a task, is posted.
+ */
+static void InitTaskWaitEvent(void);
+
+/**
+ * Post a request to load or to unload a managed task, or to change its PM class.
+ *
+ * @param pxRequest [IN] specifies the request.
+ * @return SYS_NO_ERROR_CODE if success, an error code otherwise.
+ */
+static sys_error_code_t SysPostTaskRequest(const SysTaskRequest *pxRequest);
+
+/**
+ * Serve one request to load or to unload a managed task, or to change its PM class, if there is one.
+ *
+ * @param pxContext [IN] specifies the Application Context.
+ * @return `TRUE` if a request has been served, `FALSE` if there are no pending requests.
+ */
+static boolean_t InitTaskProcessTaskRequest(ApplicationContext *pxContext);
+
+/**
+ * Load a managed task: add it to the application context, initialize its hardware resources and create the native task.
+ * If one step fails the task is removed from the application context.
+ *
+ * @param pxContext [IN] specifies the Application Context.
+ * @param pxRequest [IN] specifies the load request.
+ * @return SYS_NO_ERROR_CODE if success, an error code otherwise.
+ */
+static sys_error_code_t InitTaskLoadTask(ApplicationContext *pxContext, const SysTaskRequest *pxRequest);
+
+/**
+ * Unload a managed task: quiesce it, delete the native task and remove the task from the application context.
+ *
+ * @param pxContext [IN] specifies the Application Context.
+ * @param pxTask [IN] specifies the task.
+ * @return SYS_NO_ERROR_CODE if success, SYS_TIMEOUT_ERROR_CODE if the task has not been quiesced before the deadline,
+ *         SYS_INIT_TASK_HAS_PM_DEPENDENTS_ERROR_CODE if another task depends on the task,
+ *         or SYS_AC_TASK_NOT_FOUND_ERROR_CODE if the task is not in the application context.
+ */
+static sys_error_code_t InitTaskUnloadTask(ApplicationContext *pxContext, AManagedTask *pxTask);
+
+/**
+ * Check if a managed task is in the PM dependencies (see AMTExSetPMDependencies()) of another task of the application context.
+ *
+ * @param pxContext [IN] specifies the Application Context.
+ * @param pxTask [IN] specifies the task.
+ * @return `TRUE` if at least one task depends on pxTask, `FALSE` otherwise.
+ */
+static boolean_t InitTaskHasPMDependents(ApplicationContext *pxContext, const AManagedTask *pxTask);
+
+/**
+ * Post an event in a ring. It is lock-free, so it is safe also with nested IRQs.
+ *
+ * @param pxRing [IN] specifies a ring.
+ * @param xEvent [IN] specifies an event.
+ * @return `TRUE` if success, `FALSE` if the ring is full.
+ */
+static boolean_t SysEventRingPush(SysEventRing *pxRing, SysEvent xEvent);
+
+/**
+ * Get the number of events pending in a lane.
+ *
+ * @param pxLane [IN] specifies a lane.
+ * @param bIsFromISR [IN] `TRUE` if the function is called from an ISR.
+ * @return the number of events pending in the lane.
+ */
+static uint16_t SysEventLaneGetCount(SysEventLane *pxLane, boolean_t bIsFromISR);
+
+/**
+ * Get the sequence number of a new event posted in a lane. It is safe from a task and from an ISR.
+ *
+ * @param pxLane [IN] specifies a lane.
+ * @return the sequence number.
+ */
+static uint16_t SysEventLaneNextSeq(SysEventLane *pxLane);
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+/**
+ * Create a queue of INIT. The queues are used at every event, so if the static allocation is supported
+ * they are placed in the zero-wait state memory (see SysAllocEx()).
+ *
+ * @param uxLength [IN] specifies the maximum number of items of the queue.
+ * @param uxItemSize [IN] specifies the size in byte of an item.
+ * @return the queue handle, or NULL if out of memory.
  */
-static uint16_t InitTaskDoEnterPowerModeForPMClass(ApplicationContext *pxContext, EPMClass ePowerModeClass, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode);
+static QueueHandle_t InitTaskCreateQueue(UBaseType_t uxLength, UBaseType_t uxItemSize);
+#endif
 
 
 /* Public API definition */
@@ -175,11 +700,15 @@ sys_error_code_t SysInit(boolean_t bEnableBootIF) {
   SystemClock_Config();
   SysPowerConfig();
 
-#if( configAPPLICATION_ALLOCATED_HEAP == 1 )
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1) && (configAPPLICATION_ALLOCATED_HEAP == 1)
   // initialize the FreeRTOS heap.
   memset(ucHeap, 0, configTOTAL_HEAP_SIZE );
 #endif
 
+  /* initialize the pools of the system memory allocator and of the event attachments.*/
+  SysMemInit();
+  SysEvtPoolInit();
+
 #if INIT_TASK_CFG_ENABLE_BOOT_IF == 1
 
   if (bEnableBootIF) {
@@ -231,14 +760,21 @@ sys_error_code_t SysInit(boolean_t bEnableBootIF) {
   /* Clear the global error.*/
   SYS_CLEAR_ERROR();
 
+  /* Enable the MPU stack guard, if configured. The guard is placed at the first context switch.*/
+  STKG_INIT();
+
   SYS_DEBUGF(SYS_DBG_LEVEL_VERBOSE, ("System Initialization\r\n"));
 
   /* Create the INIT task to complete the system initialization
    after RTOS is started.*/
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
   if (xTaskCreate(InitTaskRun, "INIT", INIT_TASK_CFG_STACK_SIZE, NULL, INIT_TASK_CFG_PRIORITY, &s_xTheSystem.m_xInitTask) != pdPASS) {
     xRes = SYS_OUT_OF_MEMORY_ERROR_CODE;
     SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
   }
+#else
+  s_xTheSystem.m_xInitTask = xTaskCreateStatic(InitTaskRun, "INIT", INIT_TASK_CFG_STACK_SIZE, NULL, INIT_TASK_CFG_PRIORITY, s_xInitTaskStack, &s_xInitTaskTCB);
+#endif
 
   return xRes;
 }
@@ -246,27 +782,60 @@ sys_error_code_t SysInit(boolean_t bEnableBootIF) {
 sys_error_code_t SysPostEvent(SysEvent xEvent) {
   sys_error_code_t xRes = SYS_NO_ERROR_CODE;
   BaseType_t xResult;
+  BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+  boolean_t bIsFromISR = SYS_IS_CALLED_FROM_ISR();
+  SysEventLane *pxLane = &s_xTheSystem.m_xEventLane[E_SYS_EVT_LANE_PM];
+  uint16_t nCount;
 
   if (SYS_IS_ERROR_EVENT(xEvent)) {
     /* notify the error delegate to allow a first response to critical errors.*/
     xRes = IAEDOnNewErrEvent(s_xTheSystem.m_pxAppErrorDelegate, xEvent);
+    pxLane = &s_xTheSystem.m_xEventLane[E_SYS_EVT_LANE_ERROR];
   }
 
-  if (SYS_IS_CALLED_FROM_ISR()) {
-    xResult = xQueueSendToBackFromISR(s_xTheSystem.m_xSysQueue, &xEvent, NULL);
+  xEvent.xEvent.nSeq = SysEventLaneNextSeq(pxLane);
+  if (bIsFromISR) {
+    xResult = SysEventRingPush(&pxLane->m_xRing, xEvent) ? pdPASS : errQUEUE_FULL;
+    if ((xResult == pdPASS) && (s_xTheSystem.m_xInitTask != NULL)) {
+      (void)xTaskNotifyFromISR(s_xTheSystem.m_xInitTask, INIT_TASK_NOTIFY_SYS_EVENT, eSetBits, &xHigherPriorityTaskWoken);
+    }
   }
   else {
-    xResult = xQueueSendToBack(s_xTheSystem.m_xSysQueue, &xEvent, pdMS_TO_TICKS(50));
+    xResult = xQueueSendToBack(pxLane->m_xQueue, &xEvent, pdMS_TO_TICKS(50));
+    if (xResult == pdPASS) {
+      (void)xTaskNotify(s_xTheSystem.m_xInitTask, INIT_TASK_NOTIFY_SYS_EVENT, eSetBits);
+    }
   }
 
   if (xResult == errQUEUE_FULL) {
-    SYS_SET_SERVICE_LEVEL_ERROR_CODE(SYS_INIT_TASK_POWER_MODE_NOT_ENABLE_ERROR_CODE);
-    xRes = SYS_INIT_TASK_POWER_MODE_NOT_ENABLE_ERROR_CODE;
+    /* the event is lost, so nobody will consume its attachment.*/
+    SysEvtRelease(xEvent);
+    pxLane->m_xStats.nLostEvents++;
+    xRes = SYS_IS_ERROR_EVENT(xEvent) ? SYS_INIT_TASK_ERROR_EVENT_LOST_ERROR_CODE : SYS_INIT_TASK_POWER_MODE_NOT_ENABLE_ERROR_CODE;
+    SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+  }
+  else {
+    /* a concurrent post can be lost in the statistics. It only makes the high-water mark a bit optimistic.*/
+    nCount = SysEventLaneGetCount(pxLane, bIsFromISR);
+    if (nCount > pxLane->m_xStats.nHighWaterMark) {
+      pxLane->m_xStats.nHighWaterMark = nCount;
+    }
+  }
+
+  if (bIsFromISR) {
+    /* INIT has the highest priority, so switch to it when the ISR returns instead of waiting for the next tick.*/
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
   }
 
   return xRes;
 }
 
+SysEventLaneStats SysGetEventLaneStats(ESysEventLane eLane) {
+  assert_param((uint8_t)eLane < SYS_EVT_LANE_COUNT);
+
+  return s_xTheSystem.m_xEventLane[(uint8_t)eLane].m_xStats;
+}
+
 EPowerMode SysGetPowerMode(void) {
   return IapmhGetActivePowerMode(s_xTheSystem.m_pxAppPowerModeHelper);
 }
@@ -282,6 +851,85 @@ sys_error_code_t SysTaskErrorHandler(AManagedTask *pxTask) {
   return xRes;
 }
 
+void SysNotifyPowerModeSwitchReady(void) {
+  if (s_xTheSystem.m_xInitTask != NULL) {
+    (void)xTaskNotify(s_xTheSystem.m_xInitTask, INIT_TASK_NOTIFY_PM_SWITCH_READY, eSetBits);
+  }
+}
+
+sys_error_code_t SysPostPowerModeEventReplace(SysEvent xEvent) {
+  assert_param(!SYS_IS_ERROR_EVENT(xEvent));
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  UBaseType_t uxSavedInterruptStatus = 0;
+  uint32_t nSourceMask = 1UL << xEvent.xEvent.nSource;
+  boolean_t bIsFromISR = SYS_IS_CALLED_FROM_ISR();
+  boolean_t bPost;
+  SysEvent xOldEvent;
+
+  xEvent.xEvent.nReplace = 0;
+
+  if (bIsFromISR) {
+    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+  }
+  else {
+    taskENTER_CRITICAL();
+  }
+  xOldEvent = s_xTheSystem.m_xPMEventSlot[xEvent.xEvent.nSource];
+  s_xTheSystem.m_xPMEventSlot[xEvent.xEvent.nSource] = xEvent;
+  bPost = (s_xTheSystem.m_nPMEventSlotPending & nSourceMask) == 0U ? TRUE : FALSE;
+  s_xTheSystem.m_nPMEventSlotPending |= nSourceMask;
+  if (bIsFromISR) {
+    taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptStatus);
+  }
+  else {
+    taskEXIT_CRITICAL();
+  }
+
+  if (!bPost) {
+    /* the pending event has been replaced, so its attachment is never consumed.*/
+    SysEvtRelease(xOldEvent);
+  }
+  else {
+    /* there are no events pending for this source, so post a new one. INIT takes the event,
+     and its attachment, from the slot.*/
+    xEvent.xEvent.nReplace = 1;
+    xEvent.xEvent.nAttachment = SYS_EVT_ATTACHMENT_NONE;
+    xRes = SysPostEvent(xEvent);
+    if (SYS_IS_ERROR_CODE(xRes)) {
+      if (bIsFromISR) {
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+      }
+      else {
+        taskENTER_CRITICAL();
+      }
+      s_xTheSystem.m_nPMEventSlotPending &= ~nSourceMask;
+      xOldEvent = s_xTheSystem.m_xPMEventSlot[xEvent.xEvent.nSource];
+      s_xTheSystem.m_xPMEventSlot[xEvent.xEvent.nSource].xEvent.nAttachment = SYS_EVT_ATTACHMENT_NONE;
+      if (bIsFromISR) {
+        taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptStatus);
+      }
+      else {
+        taskEXIT_CRITICAL();
+      }
+      SysEvtRelease(xOldEvent);
+    }
+  }
+
+  return xRes;
+}
+
+uint32_t SysGetPowerModeSwitchLatency(void) {
+  return s_xTheSystem.m_nPMSwitchLatency;
+}
+
+uint32_t SysGetPowerModeSwitchSkipCount(void) {
+  return s_xTheSystem.m_nPMSwitchSkipCount;
+}
+
+void SysSetPowerModeSwitchDeadline(uint32_t nDeadlineMs) {
+  s_xTheSystem.m_nPMSwitchDeadlineMs = nDeadlineMs;
+}
+
 SysPowerStatus SysGetPowerStatus(void) {
   return IapmhGetPowerStatus(s_xTheSystem.m_pxAppPowerModeHelper);
 }
@@ -290,18 +938,93 @@ void SysResetAEDCounter(void) {
   IAEDResetCounter(s_xTheSystem.m_pxAppErrorDelegate);
 }
 
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+sys_error_code_t SysLoadTask(AManagedTask *pxTask, pSysTaskRequestDoneFunc_t pfDone) {
+  SysTaskRequest xRequest = {
+      .pxTask = pxTask,
+      .pfDone = pfDone,
+      .eOp = E_SYS_TASK_REQ_LOAD
+  };
+
+  return SysPostTaskRequest(&xRequest);
+}
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+sys_error_code_t SysLoadStaticTask(AManagedTask *pxTask, StackType_t *pxStack, StaticTask_t *pxTCB, uint16_t nStackDepth, pSysTaskRequestDoneFunc_t pfDone) {
+  SysTaskRequest xRequest = {
+      .pxTask = pxTask,
+      .pfDone = pfDone,
+      .eOp = E_SYS_TASK_REQ_LOAD,
+      .pxStack = pxStack,
+      .pxTCB = pxTCB,
+      .nStackDepth = nStackDepth
+  };
+  sys_error_code_t xRes;
+
+  if ((pxStack == NULL) || (pxTCB == NULL) || (nStackDepth == 0U)) {
+    xRes = SYS_INVALID_PARAMETER_ERROR_CODE;
+    SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+  }
+  else {
+    xRes = SysPostTaskRequest(&xRequest);
+  }
+
+  return xRes;
+}
+#endif
+
+sys_error_code_t SysUnloadTask(AManagedTask *pxTask, pSysTaskRequestDoneFunc_t pfDone) {
+  SysTaskRequest xRequest = {
+      .pxTask = pxTask,
+      .pfDone = pfDone,
+      .eOp = E_SYS_TASK_REQ_UNLOAD
+  };
+
+  return SysPostTaskRequest(&xRequest);
+}
+
+sys_error_code_t SysSetTaskPMClass(AManagedTask *pxTask, EPMClass eNewPMClass) {
+  assert_param(pxTask != NULL);
+  SysTaskRequest xRequest = {
+      .pxTask = pxTask,
+      .pfDone = NULL,
+      .eOp = E_SYS_TASK_REQ_SET_PM_CLASS,
+      .ePMClass = eNewPMClass
+  };
+  sys_error_code_t xRes;
+
+  if ((s_xTheSystem.m_xInitTask == NULL) || (xTaskGetCurrentTaskHandle() == s_xTheSystem.m_xInitTask)) {
+    /* INIT is not walking the buckets.*/
+    xRes = ACSetTaskPMClass(pxTask->m_pxContext, pxTask, eNewPMClass);
+  }
+  else {
+    xRes = SysPostTaskRequest(&xRequest);
+  }
+
+  return xRes;
+}
+
 boolean_t SysEventsPending(void) {
   boolean_t bRes = FALSE;
-  if (SYS_IS_CALLED_FROM_ISR()) {
-    bRes = uxQueueMessagesWaitingFromISR(s_xTheSystem.m_xSysQueue) > 0U ? TRUE : FALSE;
+  boolean_t bIsFromISR = SYS_IS_CALLED_FROM_ISR();
+
+  for (uint8_t i = 0; (i < SYS_EVT_LANE_COUNT) && !bRes; ++i) {
+    bRes = SysEventLaneGetCount(&s_xTheSystem.m_xEventLane[i], bIsFromISR) > 0U ? TRUE : FALSE;
   }
-  else {
-    bRes = uxQueueMessagesWaiting(s_xTheSystem.m_xSysQueue) > 0U ? TRUE : FALSE;
+
+  if (!bRes && (s_xTheSystem.m_xTaskRequestQueue != NULL)) {
+    bRes = (bIsFromISR ? uxQueueMessagesWaitingFromISR(s_xTheSystem.m_xTaskRequestQueue) : uxQueueMessagesWaiting(s_xTheSystem.m_xTaskRequestQueue)) > 0U ? TRUE : FALSE;
   }
 
   return bRes;
 }
 
+__weak const SysAppTaskEntry *SysGetAppManifest(uint8_t *pnTaskCount) {
+  *pnTaskCount = 0;
+  return NULL;
+}
+
 __weak IApplicationErrorDelegate *SysGetErrorDelegate(void) {
 
   return NullAEDAlloc();
@@ -338,16 +1061,31 @@ static void InitTaskRun(void *pParams) {
   s_xTheSystem.m_ta4Event = xTraceRegisterString("SYS_EVT");
 #endif
 
-  /* Create the queue for the system message.*/
-  s_xTheSystem.m_xSysQueue = xQueueCreate(INIT_TASK_CFG_QUEUE_LENGTH, INIT_TASK_CFG_QUEUE_ITEM_SIZE);
-  if (s_xTheSystem.m_xSysQueue == NULL) {
-    /* if s_xSysQueue is NULL then the execution is blocked by sys_error_handler().
+  /* Create the queues for the system message.*/
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+  s_xTheSystem.m_xEventLane[E_SYS_EVT_LANE_ERROR].m_xQueue = InitTaskCreateQueue(INIT_TASK_CFG_ERR_QUEUE_LENGTH, INIT_TASK_CFG_QUEUE_ITEM_SIZE);
+  s_xTheSystem.m_xEventLane[E_SYS_EVT_LANE_PM].m_xQueue = InitTaskCreateQueue(INIT_TASK_CFG_QUEUE_LENGTH, INIT_TASK_CFG_QUEUE_ITEM_SIZE);
+  s_xTheSystem.m_xTaskRequestQueue = InitTaskCreateQueue(INIT_TASK_CFG_TASK_REQ_QUEUE_LENGTH, sizeof(SysTaskRequest));
+#else
+  s_xTheSystem.m_xEventLane[E_SYS_EVT_LANE_ERROR].m_xQueue = xQueueCreateStatic(INIT_TASK_CFG_ERR_QUEUE_LENGTH, INIT_TASK_CFG_QUEUE_ITEM_SIZE,
+      s_pnErrLaneStorage, &s_xLaneQueueBuffer[E_SYS_EVT_LANE_ERROR]);
+  s_xTheSystem.m_xEventLane[E_SYS_EVT_LANE_PM].m_xQueue = xQueueCreateStatic(INIT_TASK_CFG_QUEUE_LENGTH, INIT_TASK_CFG_QUEUE_ITEM_SIZE,
+      s_pnPMLaneStorage, &s_xLaneQueueBuffer[E_SYS_EVT_LANE_PM]);
+  s_xTheSystem.m_xTaskRequestQueue = xQueueCreateStatic(INIT_TASK_CFG_TASK_REQ_QUEUE_LENGTH, sizeof(SysTaskRequest),
+      s_pnTaskRequestStorage, &s_xTaskRequestQueueBuffer);
+#endif
+  s_xTheSystem.m_xEventLane[E_SYS_EVT_LANE_ERROR].m_xStats.nDepth = INIT_TASK_CFG_ERR_QUEUE_LENGTH + INIT_TASK_CFG_ISR_RING_LENGTH;
+  s_xTheSystem.m_xEventLane[E_SYS_EVT_LANE_PM].m_xStats.nDepth = INIT_TASK_CFG_QUEUE_LENGTH + INIT_TASK_CFG_ISR_RING_LENGTH;
+  if ((s_xTheSystem.m_xEventLane[E_SYS_EVT_LANE_ERROR].m_xQueue == NULL) || (s_xTheSystem.m_xEventLane[E_SYS_EVT_LANE_PM].m_xQueue == NULL)
+      || (s_xTheSystem.m_xTaskRequestQueue == NULL)) {
+    /* if a queue is NULL then the execution is blocked by sys_error_handler().
      see bugtabs4 #5265 (WGID:201282)*/
     sys_error_handler();
   }
 
 #ifdef DEBUG
-    vQueueAddToRegistry(s_xTheSystem.m_xSysQueue, "SYS_Q");
+    vQueueAddToRegistry(s_xTheSystem.m_xEventLane[E_SYS_EVT_LANE_ERROR].m_xQueue, "SYS_ERR_Q");
+    vQueueAddToRegistry(s_xTheSystem.m_xEventLane[E_SYS_EVT_LANE_PM].m_xQueue, "SYS_Q");
 #endif
 
   /* Check if the system has resumed from WWDG reset*/
@@ -386,12 +1124,21 @@ static void InitTaskRun(void *pParams) {
     sys_error_handler();
   }
 
+  STKM_TASK_CREATED(s_xTheSystem.m_xInitTask, INIT_TASK_CFG_STACK_SIZE);
+
   /* Allocate the global application context*/
   ApplicationContext xContext;
   /* Initialize the context*/
   ACInit(&xContext);
 
-  xRes = SysLoadApplicationContext(&xContext);
+  uint8_t nManifestSize = 0;
+  const SysAppTaskEntry *pxManifest = SysGetAppManifest(&nManifestSize);
+  if (pxManifest != NULL) {
+    xRes = InitTaskLoadManifest(&xContext, pxManifest, nManifestSize);
+  }
+  else {
+    xRes = SysLoadApplicationContext(&xContext);
+  }
   if (xRes != SYS_NO_ERROR_CODE) {
     /* it seems that there is no application to run!!!*/
     SYS_DEBUGF(SYS_DBG_LEVEL_WARNING, ("INIT: no application tasks loaded!\r\n"));
@@ -426,6 +1173,8 @@ static void InitTaskRun(void *pParams) {
   void *pTaskParams;
   UBaseType_t xPriority;
 
+  /* the tasks loaded from the manifest are in the order of the manifest.*/
+  const SysAppTaskEntry *pxEntry = pxManifest;
   pxTask = ACGetFirstTask(&xContext);
   while ((pxTask != NULL) && !SYS_IS_ERROR_CODE(xRes)) {
     xRes = AMTOnCreateTask(pxTask, &pvTaskCode, &pcName, &nStackDepth, &pTaskParams, &xPriority);
@@ -433,13 +1182,37 @@ static void InitTaskRun(void *pParams) {
       SYS_SET_SERVICE_LEVEL_ERROR_CODE(SYS_INIT_TASK_FAILURE_ERROR_CODE);
       SYS_DEBUGF(SYS_DBG_LEVEL_SEVERE, ("INIT: system failure.\r\n"));
     } else {
-      xRtosRes = xTaskCreate(pvTaskCode, pcName, nStackDepth, pTaskParams, xPriority, &pxTask->m_xTaskHandle);
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+      if ((pxEntry != NULL) && (pxEntry->pxStack != NULL)) {
+        if (pxEntry->nStackDepth != nStackDepth) {
+          SYS_DEBUGF(SYS_DBG_LEVEL_WARNING, ("INIT: %s uses the stack depth of the manifest (%u).\r\n", pcName, pxEntry->nStackDepth));
+        }
+        nStackDepth = pxEntry->nStackDepth;
+        pxTask->m_xTaskHandle = xTaskCreateStatic(pvTaskCode, pcName, nStackDepth, pTaskParams, xPriority, pxEntry->pxStack, pxEntry->pxTCB);
+        xRtosRes = pxTask->m_xTaskHandle != NULL ? pdPASS : pdFAIL;
+      }
+      else
+#endif
+      {
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+        xRtosRes = xTaskCreate(pvTaskCode, pcName, nStackDepth, pTaskParams, xPriority, &pxTask->m_xTaskHandle);
+#else
+        /* in static allocation mode the memory of the task must be declared in the manifest.*/
+        xRtosRes = pdFAIL;
+#endif
+      }
       if(xRtosRes != pdPASS) {
         SYS_SET_SERVICE_LEVEL_ERROR_CODE(SYS_INIT_TASK_FAILURE_ERROR_CODE);
         SYS_DEBUGF(SYS_DBG_LEVEL_SEVERE, ("INIT: unable to create task %s.\r\n", pcName));
       }
+      else {
+        STKM_TASK_CREATED(pxTask->m_xTaskHandle, nStackDepth);
+      }
     }
     pxTask = ACGetNextTask(&xContext, pxTask);
+    if (pxEntry != NULL) {
+      pxEntry++;
+    }
   }
 
   SysOnStartApplication(&xContext);
@@ -449,25 +1222,53 @@ static void InitTaskRun(void *pParams) {
 
 #if defined(DEBUG) || defined(SYS_DEBUG)
   if (SYS_DBG_LEVEL_SL >= g_sys_dbg_min_level) {
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
     size_t nFreeHeapSize = xPortGetFreeHeapSize();
     SYS_DEBUGF(SYS_DBG_LEVEL_SL, ("INIT: free heap = %i.\r\n", nFreeHeapSize));
+#endif
     SYS_DEBUGF(SYS_DBG_LEVEL_SL, ("INIT: SystemCoreClock = %iHz.\r\n", SystemCoreClock));
   }
 #endif
 
   xTaskResumeAll();
 
+  /* report to the AED the stack overflow, if any, that caused the last reset.*/
+  STKG_REPORT_LAST_OVERFLOW();
+
   /* After the system initialization the INIT task is used to implement some system call
    because it is the owner of the Application Context.
    At the moment this is an initial implementation of a system level Power Management:
    wait for a system level power mode request*/
   SysEvent xEvent;
+  EPowerMode eNewPowerMode;
+  EPowerMode eNextPowerMode;
+  boolean_t bIsServed;
   for (;;) {
-    if (pdTRUE == xQueueReceive(s_xTheSystem.m_xSysQueue, &xEvent, portMAX_DELAY)) {
+    if (!InitTaskGetEvent(&xEvent, TRUE)) {
+      /* all the pending events have been processed, so complete the power mode switch of the late tasks
+       and serve the requests to load or unload a task.*/
+      bIsServed = InitTaskCompleteLateTasks();
+      if (InitTaskProcessTaskRequest(&xContext)) {
+        bIsServed = TRUE;
+      }
+      if (!bIsServed) {
+        InitTaskWaitEvent();
+      }
+      else {
+        /* check if the system is in a low power mode and it was waked up to serve the request.*/
+        EPowerMode eActivePowerMode = IapmhGetActivePowerMode(s_xTheSystem.m_pxAppPowerModeHelper);
+        if (IapmhIsLowPowerMode(s_xTheSystem.m_pxAppPowerModeHelper, eActivePowerMode)) {
+          /* then put the system again in low power mode.*/
+          IapmhDidEnterPowerMode(s_xTheSystem.m_pxAppPowerModeHelper, eActivePowerMode);
+        }
+      }
+    }
+    else {
       EPowerMode eActivePowerMode = IapmhGetActivePowerMode(s_xTheSystem.m_pxAppPowerModeHelper);
       /* check if it is a system error event*/
       if (SYS_IS_ERROR_EVENT(xEvent)) {
         IAEDProcessEvent(s_xTheSystem.m_pxAppErrorDelegate, &xContext, xEvent);
+        SysEvtRelease(xEvent);
         // check if the system is in low power mode and it was waked up by a strange IRQ.
         if (IapmhIsLowPowerMode(s_xTheSystem.m_pxAppPowerModeHelper, eActivePowerMode)) {
           // if the system was wake up due to an error event, then wait the error is recovered before put the MCU in STOP
@@ -478,52 +1279,21 @@ static void InitTaskRun(void *pParams) {
         }
       }
       else {
-        /* it is a power mode event*/
-        EPowerMode ePowerMode = IapmhComputeNewPowerMode(s_xTheSystem.m_pxAppPowerModeHelper, xEvent);
-        if (ePowerMode != eActivePowerMode) {
-          IapmhCheckPowerModeTransaction(s_xTheSystem.m_pxAppPowerModeHelper, eActivePowerMode, ePowerMode);
-
-          SYS_DEBUGF(SYS_DBG_LEVEL_VERBOSE, ("INIT: evt:src=%x evt:param=%x\r\n", xEvent.xEvent.nSource, xEvent.xEvent.nParam));
-
-          /* first inform the AmanagedTaskEx that a transaction in the power mode state machine
-           is going to begin.*/
-          pxTask = ACGetFirstTask(&xContext);
-          for (; pxTask!=NULL; pxTask=ACGetNextTask(&xContext, pxTask)) {
-            if (INIT_IS_KIND_OF_AMTEX(pxTask)) {
-              xRes = AMTExOnEnterPowerMode((AManagedTaskEx*)pxTask, eActivePowerMode, ePowerMode);
-              if (SYS_IS_ERROR_CODE(xRes)) {
-                sys_error_handler();
-              }
-            }
-          }
-
-          uint16_t nTaskToDoPMSwitch = ACGetTaskCount(&xContext);
-          /* then we do the power mode transaction for the task belonging to CLASS_0*/
-          nTaskToDoPMSwitch -= InitTaskDoEnterPowerModeForPMClass(&xContext, E_PM_CLASS_0, eActivePowerMode, ePowerMode);
-          if (nTaskToDoPMSwitch > 0U) {
-            /* then we do the power mode transaction for the task belonging to CLASS_1*/
-            nTaskToDoPMSwitch -= InitTaskDoEnterPowerModeForPMClass(&xContext, E_PM_CLASS_1, eActivePowerMode, ePowerMode);
-          }
-          if (nTaskToDoPMSwitch > 0U) {
-            /* then we do the power mode transaction for the task belonging to CLASS_2*/
-            nTaskToDoPMSwitch -= InitTaskDoEnterPowerModeForPMClass(&xContext, E_PM_CLASS_2, eActivePowerMode, ePowerMode);
-          }
-
-          /* Enter the specified power mode*/
-          IapmhDidEnterPowerMode(s_xTheSystem.m_pxAppPowerModeHelper, ePowerMode);
-
-          pxTask = ACGetFirstTask(&xContext);
-          for (; pxTask!=NULL; pxTask=ACGetNextTask(&xContext, pxTask)) {
-            pxTask->m_xStatus.nPowerModeSwitchDone = 0;
-            pxTask->m_xStatus.nPowerModeSwitchPending = 0;
-            vTaskResume(pxTask->m_xTaskHandle);
+        /* it is a power mode event. Fold it, together with the other pending power mode events,
+         in the target power mode of the transaction.*/
+        eNewPowerMode = InitTaskFoldPowerModeEvents(xEvent, eActivePowerMode, &eNextPowerMode);
+        if (eNewPowerMode != eActivePowerMode) {
+          InitTaskDoPowerModeTransaction(&xContext, eActivePowerMode, eNewPowerMode);
+          if (eNextPowerMode != eNewPowerMode) {
+            /* the folded transaction is not legal: the last hop is a transaction on its own.*/
+            InitTaskDoPowerModeTransaction(&xContext, eNewPowerMode, eNextPowerMode);
           }
         }
         else {
           /* check if the system is in a low power mode and it was waked up by a strange IRQ.*/
           if (IapmhIsLowPowerMode(s_xTheSystem.m_pxAppPowerModeHelper, eActivePowerMode)) {
             /* then put the system again in low power mode.*/
-            IapmhDidEnterPowerMode(s_xTheSystem.m_pxAppPowerModeHelper, ePowerMode);
+            IapmhDidEnterPowerMode(s_xTheSystem.m_pxAppPowerModeHelper, eActivePowerMode);
           }
         }
       }
@@ -531,12 +1301,478 @@ static void InitTaskRun(void *pParams) {
   }
 }
 
-static uint16_t InitTaskDoEnterPowerModeForPMClass(ApplicationContext *pxContext, EPMClass ePowerModeClass, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode) {
+static void InitTaskDoPowerModeTransaction(ApplicationContext *pxContext, const EPowerMode eActivePowerMode, const EPowerMode ePowerMode) {
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  AManagedTask *pxTask = NULL;
+
+  TickType_t xPMSwitchStartTick = xTaskGetTickCount();
+  TickType_t xDeadlineTicks = s_xTheSystem.m_nPMSwitchDeadlineMs != 0U ? pdMS_TO_TICKS(s_xTheSystem.m_nPMSwitchDeadlineMs) : portMAX_DELAY;
+  PMP_TRANSACTION_BEGIN(eActivePowerMode, ePowerMode);
+
+  /* a late task that is now ready joins the transaction from the active power mode.*/
+  (void)InitTaskCompleteLateTasks();
+
+  /* first inform the AmanagedTaskEx that a transaction in the power mode state machine
+   is going to begin. Only the tasks that change their power mode are involved in the transaction,
+   the other tasks keep running.*/
+  uint16_t nTaskToDoPMSwitch = 0;
+  PMP_PHASE_BEGIN(E_PMP_PHASE_ON_ENTER);
+  pxTask = ACGetFirstTask(pxContext);
+  for (; pxTask!=NULL; pxTask=ACGetNextTask(pxContext, pxTask)) {
+    if ((InitTaskFindLateTask(pxTask) == s_xTheSystem.m_nLateTasks) && AMTIsPowerModeSwitchRequired(pxTask, eActivePowerMode, ePowerMode)) {
+      nTaskToDoPMSwitch++;
+      if (INIT_IS_KIND_OF_AMTEX(pxTask)) {
+        PMP_TASK_BEGIN();
+        xRes = AMTExOnEnterPowerMode((AManagedTaskEx*)pxTask, eActivePowerMode, ePowerMode);
+        PMP_TASK_END(pxTask, E_PMP_TASK_PHASE_ON_ENTER);
+        if (SYS_IS_ERROR_CODE(xRes)) {
+          sys_error_handler();
+        }
+      }
+    }
+  }
+  PMP_PHASE_END(E_PMP_PHASE_ON_ENTER);
+
+  SYS_DEBUGF(SYS_DBG_LEVEL_VERBOSE, ("INIT: %u tasks do the PM transaction\r\n", nTaskToDoPMSwitch));
+
+  /* then we do the power mode transaction one PM class at time, starting from CLASS_0.
+   Inside a class the tasks proceed as soon as their dependencies did the transaction.*/
+  PMP_PHASE_BEGIN(E_PMP_PHASE_DO_ENTER);
+  for (uint8_t nPMClass = 0; (nPMClass < AMT_PM_CLASS_COUNT) && (nTaskToDoPMSwitch > 0U); ++nPMClass) {
+    PMP_CLASS_BEGIN((EPMClass)nPMClass);
+    nTaskToDoPMSwitch -= InitTaskDoEnterPowerModeForPMClass(pxContext, (EPMClass)nPMClass, eActivePowerMode, ePowerMode, xPMSwitchStartTick, xDeadlineTicks);
+    PMP_CLASS_END((EPMClass)nPMClass);
+  }
+  PMP_PHASE_END(E_PMP_PHASE_DO_ENTER);
+
+  s_xTheSystem.m_nPMSwitchLatency = (uint32_t)(xTaskGetTickCount() - xPMSwitchStartTick);
+  SYS_DEBUGF(SYS_DBG_LEVEL_VERBOSE, ("INIT: PM switch latency %u ticks\r\n", s_xTheSystem.m_nPMSwitchLatency));
+
+  /* Enter the specified power mode*/
+  PMP_PHASE_BEGIN(E_PMP_PHASE_DID_ENTER);
+  IapmhDidEnterPowerMode(s_xTheSystem.m_pxAppPowerModeHelper, ePowerMode);
+  PMP_PHASE_END(E_PMP_PHASE_DID_ENTER);
+
+  PMP_PHASE_BEGIN(E_PMP_PHASE_RESUME);
+  pxTask = ACGetFirstTask(pxContext);
+  for (; pxTask!=NULL; pxTask=ACGetNextTask(pxContext, pxTask)) {
+    /* only the tasks that did enter the new power mode are resumed. A late task keeps the power mode switch pending.*/
+    if (pxTask->m_xStatus.nPowerModeSwitchDone == 1U) {
+      (void)AMTStatusModify(pxTask, AMT_STATUS_PM_SWITCH_DONE_Msk | AMT_STATUS_PM_SWITCH_PENDING_Msk, 0U);
+      if (InitTaskHasStepFunction(pxTask)) {
+        AMTResume(pxTask);
+      }
+    }
+  }
+  PMP_PHASE_END(E_PMP_PHASE_RESUME);
+  PMP_TRANSACTION_END();
+  /* a transaction runs also the rare code paths of the tasks, so it is a good time to sample the stacks.*/
+  STKM_SAMPLE();
+}
+
+static EPowerMode InitTaskFoldPowerModeEvents(SysEvent xEvent, const EPowerMode eActivePowerMode, EPowerMode *peNextPowerMode) {
+  uint8_t nFoldedEvents = 0;
+  boolean_t bFold = TRUE;
+  EPowerMode eNewPowerMode;
+  EPowerMode eTargetPowerMode = eActivePowerMode;
+
+  while (bFold) {
+    xEvent = InitTaskTakePowerModeEvent(xEvent);
+    eNewPowerMode = IapmhComputeNewPowerModeFrom(s_xTheSystem.m_pxAppPowerModeHelper, eTargetPowerMode, xEvent);
+    SysEvtRelease(xEvent);
+    nFoldedEvents++;
+
+    SYS_DEBUGF(SYS_DBG_LEVEL_VERBOSE, ("INIT: evt:src=%x evt:param=%x\r\n", xEvent.xEvent.nSource, xEvent.xEvent.nParam));
+
+    *peNextPowerMode = eNewPowerMode;
+    if (eNewPowerMode != eTargetPowerMode) {
+      IapmhCheckPowerModeTransaction(s_xTheSystem.m_pxAppPowerModeHelper, eTargetPowerMode, eNewPowerMode);
+      if ((eTargetPowerMode != eActivePowerMode) && (eNewPowerMode != eActivePowerMode)
+          && !IapmhIsPowerModeTransactionValid(s_xTheSystem.m_pxAppPowerModeHelper, eActivePowerMode, eNewPowerMode)) {
+        /* the folded transaction is not legal: stop at the last legal target.*/
+        SYS_DEBUGF(SYS_DBG_LEVEL_VERBOSE, ("INIT: PM fold stopped at %u (%u -> %u not legal)\r\n", (uint8_t)eTargetPowerMode,
+            (uint8_t)eActivePowerMode, (uint8_t)eNewPowerMode));
+        break;
+      }
+      eTargetPowerMode = eNewPowerMode;
+    }
+
+    /* look for the next pending power mode event. An error event stops the folding so that it is
+     processed in order. If the application does not implement ComputeNewPowerModeFrom() and
+     IsPowerModeTransactionValid() the events are not folded.*/
+    bFold = FALSE;
+    if (INIT_CAN_FOLD_PM_EVENTS() && (nFoldedEvents < INIT_TASK_CFG_PM_FOLD_MAX_EVENTS) && InitTaskGetEvent(&xEvent, FALSE)) {
+      if (!SYS_IS_ERROR_EVENT(xEvent)) {
+        bFold = InitTaskGetEvent(&xEvent, TRUE);
+      }
+    }
+  }
+
+  if (nFoldedEvents > 1U) {
+    SYS_DEBUGF(SYS_DBG_LEVEL_VERBOSE, ("INIT: %u PM events folded in the transaction %u -> %u\r\n", nFoldedEvents,
+        (uint8_t)eActivePowerMode, (uint8_t)eTargetPowerMode));
+  }
+
+  return eTargetPowerMode;
+}
+
+static SysEvent InitTaskTakePowerModeEvent(SysEvent xEvent) {
+  uint32_t nSourceMask;
+
+  if (xEvent.xEvent.nReplace == 1U) {
+    /* the event has been posted with SysPostPowerModeEventReplace(): take the last value posted for this source.*/
+    nSourceMask = 1UL << xEvent.xEvent.nSource;
+    taskENTER_CRITICAL();
+    xEvent = s_xTheSystem.m_xPMEventSlot[xEvent.xEvent.nSource];
+    s_xTheSystem.m_nPMEventSlotPending &= ~nSourceMask;
+    taskEXIT_CRITICAL();
+  }
+
+  return xEvent;
+}
+
+static boolean_t InitTaskGetEvent(SysEvent *pxEvent, boolean_t bRemove) {
+  boolean_t bRes = InitTaskLaneGetEvent(&s_xTheSystem.m_xEventLane[E_SYS_EVT_LANE_ERROR], pxEvent, bRemove);
+
+  if (!bRes) {
+    bRes = InitTaskLaneGetEvent(&s_xTheSystem.m_xEventLane[E_SYS_EVT_LANE_PM], pxEvent, bRemove);
+  }
+
+  return bRes;
+}
+
+static boolean_t InitTaskLaneGetEvent(SysEventLane *pxLane, SysEvent *pxEvent, boolean_t bRemove) {
+  boolean_t bRes = FALSE;
+  SysEventRing *pxRing = &pxLane->m_xRing;
+  uint32_t nIdx = pxRing->m_nTail & (INIT_TASK_CFG_ISR_RING_LENGTH - 1U);
+  SysEvent xQueuedEvent;
+  boolean_t bIsInQueue = (pdTRUE == xQueuePeek(pxLane->m_xQueue, &xQueuedEvent, 0)) ? TRUE : FALSE;
+
+  if ((pxRing->m_nHead != pxRing->m_nTail) && (pxRing->m_nReady[nIdx] != 0U)
+      && (!bIsInQueue || INIT_EVT_SEQ_IS_BEFORE(pxRing->m_xItems[nIdx].xEvent.nSeq, xQueuedEvent.xEvent.nSeq))) {
+    *pxEvent = pxRing->m_xItems[nIdx];
+    if (bRemove) {
+      pxRing->m_nReady[nIdx] = 0U;
+      /* the item must be read before it is released to the producers.*/
+      __DMB();
+      pxRing->m_nTail++;
+    }
+    bRes = TRUE;
+  }
+  else if (bIsInQueue) {
+    /* INIT is the only consumer of the queue, so the peeked event is the one removed.*/
+    *pxEvent = xQueuedEvent;
+    if (bRemove) {
+      (void)xQueueReceive(pxLane->m_xQueue, &xQueuedEvent, 0);
+    }
+    bRes = TRUE;
+  }
+
+  return bRes;
+}
+
+static void InitTaskProcessErrorEvents(ApplicationContext *pxContext) {
+  SysEvent xEvent;
+
+  while (InitTaskLaneGetEvent(&s_xTheSystem.m_xEventLane[E_SYS_EVT_LANE_ERROR], &xEvent, TRUE)) {
+    IAEDProcessEvent(s_xTheSystem.m_pxAppErrorDelegate, pxContext, xEvent);
+    SysEvtRelease(xEvent);
+  }
+}
+
+static sys_error_code_t InitTaskLoadManifest(ApplicationContext *pxContext, const SysAppTaskEntry *pxManifest, uint8_t nTaskCount) {
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  AManagedTask *pxTask;
+
+  /* the tasks are pushed at the head of the context, so the manifest is visited backward.*/
+  for (uint8_t i = nTaskCount; (i > 0U) && !SYS_IS_ERROR_CODE(xRes); --i) {
+    pxTask = pxManifest[i - 1U].pfAlloc(pxManifest[i - 1U].pvParams);
+    if (pxTask == NULL) {
+      xRes = SYS_OUT_OF_MEMORY_ERROR_CODE;
+      SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+    }
+    else {
+      xRes = ACPushTask(pxContext, pxTask);
+    }
+  }
+
+  return xRes;
+}
+
+static void InitTaskWaitEvent(void) {
+  /* the notification is sent after the event is posted, so an event posted after the last check
+   leaves the notification pending and INIT does not block.*/
+  (void)xTaskNotifyWait(0, INIT_TASK_NOTIFY_SYS_EVENT, NULL, portMAX_DELAY);
+}
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+static QueueHandle_t InitTaskCreateQueue(UBaseType_t uxLength, UBaseType_t uxItemSize) {
+  QueueHandle_t xQueue = NULL;
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+  /* the control block and the storage of the queue are allocated in one block, as xQueueCreate() does.*/
+  StaticQueue_t *pxQueueBuffer = (StaticQueue_t*)SysAllocEx(sizeof(StaticQueue_t) + (uxLength * uxItemSize), E_SYS_MEM_FAST);
+
+  if (pxQueueBuffer != NULL) {
+    xQueue = xQueueCreateStatic(uxLength, uxItemSize, (uint8_t*)(pxQueueBuffer + 1), pxQueueBuffer);
+  }
+#else
+  xQueue = xQueueCreate(uxLength, uxItemSize);
+#endif
+
+  return xQueue;
+}
+#endif
+
+static sys_error_code_t SysPostTaskRequest(const SysTaskRequest *pxRequest) {
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+
+  if (pxRequest->pxTask == NULL) {
+    xRes = SYS_INVALID_PARAMETER_ERROR_CODE;
+  }
+  else if (SYS_IS_CALLED_FROM_ISR() || (s_xTheSystem.m_xTaskRequestQueue == NULL)) {
+    xRes = SYS_INVALID_FUNC_CALL_ERROR_CODE;
+  }
+  else if (xQueueSendToBack(s_xTheSystem.m_xTaskRequestQueue, pxRequest, pdMS_TO_TICKS(50)) != pdPASS) {
+    xRes = SYS_TASK_QUEUE_FULL_ERROR_CODE;
+  }
+  else {
+    (void)xTaskNotify(s_xTheSystem.m_xInitTask, INIT_TASK_NOTIFY_SYS_EVENT, eSetBits);
+  }
+
+  if (SYS_IS_ERROR_CODE(xRes)) {
+    SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+  }
+
+  return xRes;
+}
+
+static boolean_t InitTaskProcessTaskRequest(ApplicationContext *pxContext) {
+  SysTaskRequest xRequest;
+  sys_error_code_t xRes;
+  boolean_t bRes = (pdTRUE == xQueueReceive(s_xTheSystem.m_xTaskRequestQueue, &xRequest, 0)) ? TRUE : FALSE;
+
+  if (bRes) {
+    if (xRequest.eOp == E_SYS_TASK_REQ_LOAD) {
+      xRes = InitTaskLoadTask(pxContext, &xRequest);
+    }
+    else if (xRequest.eOp == E_SYS_TASK_REQ_SET_PM_CLASS) {
+      xRes = (xRequest.pxTask->m_pxContext == pxContext) ? ACSetTaskPMClass(pxContext, xRequest.pxTask, xRequest.ePMClass) : SYS_INVALID_PARAMETER_ERROR_CODE;
+    }
+    else {
+      xRes = InitTaskUnloadTask(pxContext, xRequest.pxTask);
+    }
+
+    if (xRequest.pfDone != NULL) {
+      xRequest.pfDone(xRequest.pxTask, xRes);
+    }
+  }
+
+  return bRes;
+}
+
+static sys_error_code_t InitTaskLoadTask(ApplicationContext *pxContext, const SysTaskRequest *pxRequest) {
+  AManagedTask *pxTask = pxRequest->pxTask;
+  TaskFunction_t pvTaskCode;
+  const char *pcName = NULL;
+  unsigned short nStackDepth;
+  void *pTaskParams;
+  UBaseType_t xPriority;
+  BaseType_t xRtosRes = pdFAIL;
+  sys_error_code_t xRes = ACAddTask(pxContext, pxTask);
+
+  if (!SYS_IS_ERROR_CODE(xRes)) {
+    xRes = AMTHardwareInit(pxTask, NULL);
+    if (!SYS_IS_ERROR_CODE(xRes)) {
+      xRes = AMTOnCreateTask(pxTask, &pvTaskCode, &pcName, &nStackDepth, &pTaskParams, &xPriority);
+    }
+    if (!SYS_IS_ERROR_CODE(xRes)) {
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+      if (pxRequest->pxStack != NULL) {
+        nStackDepth = pxRequest->nStackDepth;
+        pxTask->m_xTaskHandle = xTaskCreateStatic(pvTaskCode, pcName, nStackDepth, pTaskParams, xPriority, pxRequest->pxStack, pxRequest->pxTCB);
+        xRtosRes = pxTask->m_xTaskHandle != NULL ? pdPASS : pdFAIL;
+      }
+      else
+#endif
+      {
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+        xRtosRes = xTaskCreate(pvTaskCode, pcName, nStackDepth, pTaskParams, xPriority, &pxTask->m_xTaskHandle);
+#endif
+      }
+      if (xRtosRes != pdPASS) {
+        xRes = SYS_OUT_OF_MEMORY_ERROR_CODE;
+      }
+      else {
+        STKM_TASK_CREATED(pxTask->m_xTaskHandle, nStackDepth);
+      }
+    }
+
+    if (SYS_IS_ERROR_CODE(xRes)) {
+      (void)ACRemoveTask(pxContext, pxTask);
+      SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+      SYS_DEBUGF(SYS_DBG_LEVEL_WARNING, ("INIT: unable to load task %s.\r\n", pcName != NULL ? pcName : "?"));
+    }
+    else {
+      SYS_DEBUGF(SYS_DBG_LEVEL_VERBOSE, ("INIT: task %s loaded. Free heap = %i.\r\n", pcName, INIT_FREE_HEAP_SIZE()));
+    }
+  }
+
+  return xRes;
+}
+
+static sys_error_code_t InitTaskUnloadTask(ApplicationContext *pxContext, AManagedTask *pxTask) {
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+  EPowerMode eActivePowerMode = IapmhGetActivePowerMode(s_xTheSystem.m_pxAppPowerModeHelper);
+  TickType_t xStartTick = xTaskGetTickCount();
+  TickType_t xDeadlineTicks = s_xTheSystem.m_nPMSwitchDeadlineMs != 0U ? pdMS_TO_TICKS(s_xTheSystem.m_nPMSwitchDeadlineMs) : portMAX_DELAY;
+
+  if (pxTask->m_pxContext != pxContext) {
+    xRes = SYS_AC_TASK_NOT_FOUND_ERROR_CODE;
+    SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+  }
+  else if (InitTaskHasPMDependents(pxContext, pxTask)) {
+    /* the dependencies are not copied, so the dependent tasks would keep a reference to the deleted task.*/
+    xRes = SYS_INIT_TASK_HAS_PM_DEPENDENTS_ERROR_CODE;
+    SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+    SYS_DEBUGF(SYS_DBG_LEVEL_WARNING, ("INIT: task %s has PM dependents.\r\n", pcTaskGetName(pxTask->m_xTaskHandle)));
+  }
+  else {
+    /* quiesce the task with the handshake of a power mode transaction: when the pending flag is set
+     the task completes its step, clears the delay flag and waits to be resumed (see AMTWaitPowerModeSwitch()).*/
+    (void)AMTStatusModify(pxTask, 0U, AMT_STATUS_PM_SWITCH_PENDING_Msk);
+    while ((pxTask->m_xStatus.nDelayPowerModeSwitch != 0U) && !SYS_IS_ERROR_CODE(xRes)) {
+      if (INIT_IS_KIND_OF_AMTEX(pxTask)) {
+        AMTExForceExecuteStep((AManagedTaskEx*)pxTask, eActivePowerMode);
+        if (AMTExIsTaskInactive((AManagedTaskEx*)pxTask)) {
+          (void)xTaskAbortDelay(pxTask->m_xTaskHandle);
+        }
+      }
+      if ((xDeadlineTicks != portMAX_DELAY) && ((xTaskGetTickCount() - xStartTick) >= xDeadlineTicks)) {
+        xRes = SYS_TIMEOUT_ERROR_CODE;
+      }
+      else {
+        (void)xTaskNotifyWait(0, INIT_TASK_NOTIFY_PM_SWITCH_READY, NULL, pdMS_TO_TICKS(INIT_TASK_CFG_PM_SWITCH_DELAY_MS));
+        InitTaskProcessErrorEvents(pxContext);
+      }
+    }
+
+    if (SYS_IS_ERROR_CODE(xRes)) {
+      /* the task keeps running. A late task keeps the power mode switch pending.*/
+      if (InitTaskFindLateTask(pxTask) == s_xTheSystem.m_nLateTasks) {
+        (void)AMTStatusModify(pxTask, AMT_STATUS_PM_SWITCH_PENDING_Msk, 0U);
+      }
+      SYS_SET_SERVICE_LEVEL_ERROR_CODE(xRes);
+      SYS_DEBUGF(SYS_DBG_LEVEL_WARNING, ("INIT: unable to quiesce task %s.\r\n", pcTaskGetName(pxTask->m_xTaskHandle)));
+    }
+    else {
+      /* the task is not in a step, and INIT has the highest priority, so the task cannot run anymore.
+       INIT is not the task to be deleted, so the kernel frees the TCB and the stack immediately, if they are in the heap.*/
+      if (InitTaskFindLateTask(pxTask) < s_xTheSystem.m_nLateTasks) {
+        InitTaskRemoveLateTask(InitTaskFindLateTask(pxTask));
+      }
+      STKM_TASK_DELETED(pxTask->m_xTaskHandle);
+      PMP_TASK_DELETED(pxTask);
+      vTaskDelete(pxTask->m_xTaskHandle);
+      pxTask->m_xTaskHandle = NULL;
+      (void)AMTStatusModify(pxTask, AMT_STATUS_PM_SWITCH_PENDING_Msk | AMT_STATUS_PM_SWITCH_DONE_Msk, 0U);
+      xRes = ACRemoveTask(pxContext, pxTask);
+      SYS_DEBUGF(SYS_DBG_LEVEL_VERBOSE, ("INIT: task unloaded. Free heap = %i.\r\n", INIT_FREE_HEAP_SIZE()));
+    }
+  }
+
+  return xRes;
+}
+
+static boolean_t InitTaskHasPMDependents(ApplicationContext *pxContext, const AManagedTask *pxTask) {
+  boolean_t bRes = FALSE;
+  AManagedTaskEx *pxTaskEx;
+
+  for (AManagedTask *pxOther = ACGetFirstTask(pxContext); (pxOther != NULL) && !bRes; pxOther = ACGetNextTask(pxContext, pxOther)) {
+    if ((pxOther != pxTask) && INIT_IS_KIND_OF_AMTEX(pxOther)) {
+      pxTaskEx = (AManagedTaskEx*)pxOther;
+      for (uint8_t i = 0; (i < pxTaskEx->m_nPMDependencies) && !bRes; ++i) {
+        bRes = (pxTaskEx->m_pxPMDependencies[i] == pxTask) ? TRUE : FALSE;
+      }
+    }
+  }
+
+  return bRes;
+}
+
+static boolean_t SysEventRingPush(SysEventRing *pxRing, SysEvent xEvent) {
+  boolean_t bRes = TRUE;
+  uint32_t nHead;
+
+  /* reserve an item of the ring.*/
+#if (INIT_RING_USE_EXCLUSIVE_ACCESS == 1)
+  do {
+    nHead = __LDREXW(&pxRing->m_nHead);
+    if ((nHead - pxRing->m_nTail) >= INIT_TASK_CFG_ISR_RING_LENGTH) {
+      __CLREX();
+      bRes = FALSE;
+      break;
+    }
+  } while (__STREXW(nHead + 1U, &pxRing->m_nHead) != 0U);
+#else
+  UBaseType_t uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+  nHead = pxRing->m_nHead;
+  if ((nHead - pxRing->m_nTail) >= INIT_TASK_CFG_ISR_RING_LENGTH) {
+    bRes = FALSE;
+  }
+  else {
+    pxRing->m_nHead = nHead + 1U;
+  }
+  taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptStatus);
+#endif
+
+  if (bRes) {
+    pxRing->m_xItems[nHead & (INIT_TASK_CFG_ISR_RING_LENGTH - 1U)] = xEvent;
+    /* the event must be written before it is published to INIT.*/
+    __DMB();
+    pxRing->m_nReady[nHead & (INIT_TASK_CFG_ISR_RING_LENGTH - 1U)] = 1U;
+  }
+
+  return bRes;
+}
+
+static uint16_t SysEventLaneNextSeq(SysEventLane *pxLane) {
+  uint32_t nSeq;
+
+#if (INIT_RING_USE_EXCLUSIVE_ACCESS == 1)
+  do {
+    nSeq = __LDREXW(&pxLane->m_nNextSeq);
+  } while (__STREXW(nSeq + 1U, &pxLane->m_nNextSeq) != 0U);
+#else
+  UBaseType_t uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+  nSeq = pxLane->m_nNextSeq;
+  pxLane->m_nNextSeq = nSeq + 1U;
+  taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptStatus);
+#endif
+
+  return (uint16_t)nSeq;
+}
+
+static uint16_t SysEventLaneGetCount(SysEventLane *pxLane, boolean_t bIsFromISR) {
+  uint32_t nCount = pxLane->m_xRing.m_nHead - pxLane->m_xRing.m_nTail;
+
+  if (pxLane->m_xQueue != NULL) {
+    nCount += bIsFromISR ? uxQueueMessagesWaitingFromISR(pxLane->m_xQueue) : uxQueueMessagesWaiting(pxLane->m_xQueue);
+  }
+
+  return (uint16_t)nCount;
+}
+
+static uint16_t InitTaskDoEnterPowerModeForPMClass(ApplicationContext *pxContext, EPMClass ePowerModeClass, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode, TickType_t xStartTick, TickType_t xDeadlineTicks) {
   /* Forward the request to all managed tasks*/
   AManagedTask *pTask = NULL;
-  EPMClass eTaskPMClass;
   boolean_t bDelayPowerModeSwitch;
+  boolean_t bIsTaskWaitingReady;
+  boolean_t bIgnoreDependencies = FALSE;
+  boolean_t bIsDeadlineExpired = FALSE;
   uint16_t nTaskCount = 0;
+  uint16_t nTaskCountInPass;
+  SysPMDependencyBreak xBroken[INIT_TASK_CFG_MAX_BROKEN_PM_DEPENDENCIES];
+  uint8_t nBroken = 0;
 
 #if (SYS_DBG_ENABLE_TA4 == 1)
   char *pcTaskName = NULL;
@@ -544,46 +1780,291 @@ static uint16_t InitTaskDoEnterPowerModeForPMClass(ApplicationContext *pxContext
 
   do {
     bDelayPowerModeSwitch = FALSE;
-    pTask = ACGetFirstTask(pxContext);
-    for (; pTask!=NULL; pTask=ACGetNextTask(pxContext, pTask)) {
+    bIsTaskWaitingReady = FALSE;
+    nTaskCountInPass = 0;
+    /* visit only the tasks belonging to ePowerModeClass*/
+    pTask = ACGetFirstTaskInPMClass(pxContext, ePowerModeClass);
+    for (; pTask!=NULL; pTask=ACGetNextTaskInPMClass(pxContext, pTask)) {
 #if (SYS_DBG_ENABLE_TA4 == 1)
       pcTaskName = pcTaskGetName(pTask->m_xTaskHandle);
 #endif
-      /* check if the task is a AMTEx and, in case, if its power mode class is equal to ePowerModeClass*/
-      eTaskPMClass = INIT_IS_KIND_OF_AMTEX(pTask) ? AMTExGetPMClass((AManagedTaskEx*)pTask) : E_PM_CLASS_0;
-      if (eTaskPMClass == ePowerModeClass) {
+      if ((InitTaskFindLateTask(pTask) == s_xTheSystem.m_nLateTasks) && AMTIsPowerModeSwitchRequired(pTask, eActivePowerMode, eNewPowerMode)) {
         /* notify the task that the power mode is changing,
          so the task will suspend.*/
-        pTask->m_xStatus.nPowerModeSwitchPending = 1;
+        (void)AMTStatusModify(pTask, 0U, AMT_STATUS_PM_SWITCH_PENDING_Msk);
         if (pTask->m_xStatus.nPowerModeSwitchDone == 0) {
-          if ((pTask->m_xStatus.nDelayPowerModeSwitch == 0)) {
+          if (!bIgnoreDependencies && INIT_IS_KIND_OF_AMTEX(pTask)
+              && (InitTaskGetPendingPMDependency((AManagedTaskEx*)pTask, eActivePowerMode, eNewPowerMode, xBroken, nBroken) != NULL)) {
+            /* the task waits for its dependencies. It is visited again in the next pass.*/
+            bDelayPowerModeSwitch = TRUE;
+          }
+          else if ((pTask->m_xStatus.nDelayPowerModeSwitch == 0)) {
 #if (SYS_DBG_ENABLE_TA4 == 1)
             if (xTraceIsRecordingEnabled()) {
               vTracePrintF(s_xTheSystem.m_ta4Event, "%s DoEPM", pcTaskName);
             }
 #endif
+            PMP_TASK_BEGIN();
             AMTDoEnterPowerMode(pTask, eActivePowerMode, eNewPowerMode);
-            pTask->m_xStatus.nPowerModeSwitchDone = 1;
-            pTask->m_xStatus.nIsTaskStillRunning = 1;
+            PMP_TASK_END(pTask, E_PMP_TASK_PHASE_DO_ENTER);
+            (void)AMTStatusModify(pTask, 0U, AMT_STATUS_PM_SWITCH_DONE_Msk | AMT_STATUS_IS_STILL_RUNNING_Msk);
             nTaskCount++;
+            nTaskCountInPass++;
+          }
+          else if (bIsDeadlineExpired) {
+            /* the task is not waited anymore and it is left out of the transaction: it did not enter the new power mode,
+             and it keeps the power mode switch pending, so it stops in AMTWaitPowerModeSwitch() as soon as it is ready.
+             Then INIT completes its power mode switch (see InitTaskCompleteLateTasks()). The AED decides how to recover.*/
+            if (InitTaskAddLateTask(pTask, eActivePowerMode)) {
+              InitTaskReportDeadlineMiss(pxContext, pTask, eActivePowerMode, eNewPowerMode, FALSE);
+            }
+            else {
+              /* the list of the late tasks is full: the task skips the transaction and it keeps running.
+               It is resumed in case it became ready after the last check.*/
+              (void)AMTStatusModify(pTask, AMT_STATUS_PM_SWITCH_PENDING_Msk, 0U);
+              AMTResume(pTask);
+              s_xTheSystem.m_nPMSwitchSkipCount++;
+              InitTaskReportDeadlineMiss(pxContext, pTask, eActivePowerMode, eNewPowerMode, TRUE);
+            }
+            nTaskCount++;
+            nTaskCountInPass++;
           }
           else {
             /* check if it is an Extended Managed Task*/
             if (pTask->m_xStatus.nReserved == 1U) {
               // force the step execution to prepare the task for the power mode switch.
               AMTExForceExecuteStep((AManagedTaskEx*)pTask, eActivePowerMode);
+              if (AMTExIsTaskInactive((AManagedTaskEx*)pTask)) {
+                /* the task is blocked without timeout, so wake it up to let it see the pending power mode switch.*/
+                (void)xTaskAbortDelay(pTask->m_xTaskHandle);
+              }
             }
             bDelayPowerModeSwitch = TRUE;
+            bIsTaskWaitingReady = TRUE;
           }
         }
       }
     }
 
-    if (bDelayPowerModeSwitch == TRUE) {
-      vTaskDelay(pdMS_TO_TICKS(INIT_TASK_CFG_PM_SWITCH_DELAY_MS));
+    /* if some tasks did the transaction in this pass, then their dependents are visited again without waiting.*/
+    if ((bDelayPowerModeSwitch == TRUE) && (nTaskCountInPass == 0U)) {
+      if (bIsTaskWaitingReady == TRUE) {
+        /* wait until a task is ready for the power mode switch (see SysNotifyPowerModeSwitchReady()).
+         The timeout allows to force again the step execution of the AManagedTaskEx.
+         A new system event wakes INIT too, so the error events are served without waiting the end of the transaction.*/
+        PMP_PHASE_BEGIN(E_PMP_PHASE_WAIT);
+        (void)xTaskNotifyWait(0, INIT_TASK_NOTIFY_PM_SWITCH_READY, NULL, pdMS_TO_TICKS(INIT_TASK_CFG_PM_SWITCH_DELAY_MS));
+        PMP_PHASE_END(E_PMP_PHASE_WAIT);
+        InitTaskProcessErrorEvents(pxContext);
+        if ((xDeadlineTicks != portMAX_DELAY) && ((xTaskGetTickCount() - xStartTick) >= xDeadlineTicks)) {
+          /* the next pass skips the tasks that are still not ready. A late task never does the transaction,
+           so the dependencies are not waited anymore.*/
+          bIsDeadlineExpired = TRUE;
+          bIgnoreDependencies = TRUE;
+        }
+      }
+      else {
+        /* all the remaining tasks wait for a dependency that cannot be satisfied in this PM class:
+         a cycle or a dependency on a task of a higher PM class. Only the offending dependency is ignored.*/
+        SYS_DEBUGF(SYS_DBG_LEVEL_WARNING, ("INIT: PM dependencies not satisfiable in class %u\r\n", (uint8_t)ePowerModeClass));
+        SYS_SET_SERVICE_LEVEL_ERROR_CODE(SYS_INIT_TASK_PM_DEPENDENCY_ERROR_CODE);
+        if ((nBroken < INIT_TASK_CFG_MAX_BROKEN_PM_DEPENDENCIES)
+            && InitTaskFindOffendingPMDependency(pxContext, ePowerModeClass, eActivePowerMode, eNewPowerMode, xBroken, nBroken, &xBroken[nBroken])) {
+          InitTaskReportPMDependencyBreak(pxContext, &xBroken[nBroken]);
+          nBroken++;
+        }
+        else {
+          /* too many dependencies are broken: ignore all of them for the rest of the transaction.*/
+          bIgnoreDependencies = TRUE;
+        }
+      }
     }
 
   } while (bDelayPowerModeSwitch == TRUE);
 
   return nTaskCount;
 }
+
+static void InitTaskReportDeadlineMiss(ApplicationContext *pxContext, AManagedTask *pxTask, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode, boolean_t bIsSkipped) {
+  assert_param(sizeof(SysPMDeadlineMiss) <= SYS_EVT_POOL_CFG_BLOCK_SIZE);
+  SysEvent xEvent;
+  SysPMDeadlineMiss *pxInfo;
+
+  SYS_DEBUGF(SYS_DBG_LEVEL_WARNING, ("INIT: %s missed the PM deadline\r\n", pcTaskGetName(pxTask->m_xTaskHandle)));
+
+  xEvent.nRawEvent = SYS_ERR_MAKE_EVENT(SYS_ERR_EVT_SRC_INIT, SYS_ERR_EVT_PARAM_PM_DEADLINE);
+  pxInfo = (SysPMDeadlineMiss*)SysEvtPoolAlloc();
+  if (pxInfo != NULL) {
+    pxInfo->pxTask = pxTask;
+    pxInfo->eActivePowerMode = eActivePowerMode;
+    pxInfo->eNewPowerMode = eNewPowerMode;
+    pxInfo->bIsSkipped = bIsSkipped;
+    (void)SysEvtAttach(&xEvent, pxInfo);
+  }
+
+  /* INIT is the only consumer of the error lane, so it must not wait on it: the event is delivered to
+   the first responders and to the AED directly, as SysPostErrorEvent() and InitTaskProcessErrorEvents() do.*/
+  (void)IAEDOnNewErrEvent(s_xTheSystem.m_pxAppErrorDelegate, xEvent);
+  (void)IAEDProcessEvent(s_xTheSystem.m_pxAppErrorDelegate, pxContext, xEvent);
+  SysEvtRelease(xEvent);
+}
+
+static AManagedTask *InitTaskGetPendingPMDependency(AManagedTaskEx *pxTaskEx, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode, const SysPMDependencyBreak *pxBroken, uint8_t nBroken) {
+  AManagedTask *pxDependency = NULL;
+  AManagedTask *pxRes = NULL;
+  uint8_t nIdx;
+
+  for (uint8_t i = 0; (i < pxTaskEx->m_nPMDependencies) && (pxRes == NULL); ++i) {
+    pxDependency = pxTaskEx->m_pxPMDependencies[i];
+    if ((pxDependency->m_xStatus.nPowerModeSwitchDone == 0U) && AMTIsPowerModeSwitchRequired(pxDependency, eActivePowerMode, eNewPowerMode)) {
+      /* check if the dependency has been broken.*/
+      nIdx = 0;
+      while ((nIdx < nBroken) && ((pxBroken[nIdx].pxTask != (AManagedTask*)pxTaskEx) || (pxBroken[nIdx].pxDependency != pxDependency))) {
+        nIdx++;
+      }
+      if (nIdx == nBroken) {
+        pxRes = pxDependency;
+      }
+    }
+  }
+
+  return pxRes;
+}
+
+static boolean_t InitTaskFindOffendingPMDependency(ApplicationContext *pxContext, EPMClass ePowerModeClass, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode,
+    const SysPMDependencyBreak *pxBroken, uint8_t nBroken, SysPMDependencyBreak *pxDependency) {
+  AManagedTask *pxTask = NULL;
+  AManagedTask *pxNext = NULL;
+  uint8_t nSteps = ACGetTaskCountInPMClass(pxContext, ePowerModeClass);
+
+  pxDependency->eActivePowerMode = eActivePowerMode;
+  pxDependency->eNewPowerMode = eNewPowerMode;
+
+  /* start from a task of the class that is waiting for a dependency.*/
+  pxDependency->pxDependency = NULL;
+  pxTask = ACGetFirstTaskInPMClass(pxContext, ePowerModeClass);
+  for (; (pxTask != NULL) && (pxDependency->pxDependency == NULL); pxTask = ACGetNextTaskInPMClass(pxContext, pxTask)) {
+    if (INIT_IS_KIND_OF_AMTEX(pxTask) && (pxTask->m_xStatus.nPowerModeSwitchDone == 0U) && (InitTaskFindLateTask(pxTask) == s_xTheSystem.m_nLateTasks)
+        && AMTIsPowerModeSwitchRequired(pxTask, eActivePowerMode, eNewPowerMode)) {
+      pxDependency->pxTask = pxTask;
+      pxDependency->pxDependency = InitTaskGetPendingPMDependency((AManagedTaskEx*)pxTask, eActivePowerMode, eNewPowerMode, pxBroken, nBroken);
+    }
+  }
+
+  /* then follow the pending dependencies. A dependency that is not waiting for a dependency of the same class
+   cannot do the transaction in this class, and after nSteps steps the walk is inside a cycle.*/
+  while ((pxDependency->pxDependency != NULL) && (nSteps > 0U)) {
+    pxNext = NULL;
+    if (INIT_IS_KIND_OF_AMTEX(pxDependency->pxDependency) && (AMTExGetPMClass((AManagedTaskEx*)pxDependency->pxDependency) == ePowerModeClass)
+        && (InitTaskFindLateTask(pxDependency->pxDependency) == s_xTheSystem.m_nLateTasks)) {
+      pxNext = InitTaskGetPendingPMDependency((AManagedTaskEx*)pxDependency->pxDependency, eActivePowerMode, eNewPowerMode, pxBroken, nBroken);
+    }
+    if (pxNext == NULL) {
+      nSteps = 0;
+    }
+    else {
+      pxDependency->pxTask = pxDependency->pxDependency;
+      pxDependency->pxDependency = pxNext;
+      nSteps--;
+    }
+  }
+
+  return (pxDependency->pxDependency != NULL) ? TRUE : FALSE;
+}
+
+static void InitTaskReportPMDependencyBreak(ApplicationContext *pxContext, const SysPMDependencyBreak *pxDependency) {
+  assert_param(sizeof(SysPMDependencyBreak) <= SYS_EVT_POOL_CFG_BLOCK_SIZE);
+  SysEvent xEvent;
+  SysPMDependencyBreak *pxInfo;
+
+  SYS_DEBUGF(SYS_DBG_LEVEL_WARNING, ("INIT: PM dependency %s -> %s ignored\r\n", pcTaskGetName(pxDependency->pxTask->m_xTaskHandle),
+      pcTaskGetName(pxDependency->pxDependency->m_xTaskHandle)));
+
+  xEvent.nRawEvent = SYS_ERR_MAKE_EVENT(SYS_ERR_EVT_SRC_INIT, SYS_ERR_EVT_PARAM_PM_DEPENDENCY);
+  pxInfo = (SysPMDependencyBreak*)SysEvtPoolAlloc();
+  if (pxInfo != NULL) {
+    *pxInfo = *pxDependency;
+    (void)SysEvtAttach(&xEvent, pxInfo);
+  }
+
+  /* as in InitTaskReportDeadlineMiss() the event is delivered to the AED directly.*/
+  (void)IAEDOnNewErrEvent(s_xTheSystem.m_pxAppErrorDelegate, xEvent);
+  (void)IAEDProcessEvent(s_xTheSystem.m_pxAppErrorDelegate, pxContext, xEvent);
+  SysEvtRelease(xEvent);
+}
+
+static boolean_t InitTaskAddLateTask(AManagedTask *pxTask, const EPowerMode eActivePowerMode) {
+  boolean_t bRes = FALSE;
+
+  if (s_xTheSystem.m_nLateTasks < INIT_TASK_CFG_MAX_LATE_TASKS) {
+    s_xTheSystem.m_pxLateTask[s_xTheSystem.m_nLateTasks] = pxTask;
+    s_xTheSystem.m_eLateTaskPowerMode[s_xTheSystem.m_nLateTasks] = eActivePowerMode;
+    s_xTheSystem.m_nLateTasks++;
+    bRes = TRUE;
+  }
+
+  return bRes;
+}
+
+static uint8_t InitTaskFindLateTask(const AManagedTask *pxTask) {
+  uint8_t nIdx = 0;
+
+  while ((nIdx < s_xTheSystem.m_nLateTasks) && (s_xTheSystem.m_pxLateTask[nIdx] != pxTask)) {
+    nIdx++;
+  }
+
+  return nIdx;
+}
+
+static void InitTaskRemoveLateTask(uint8_t nIdx) {
+  assert_param(nIdx < s_xTheSystem.m_nLateTasks);
+
+  /* the order of the list is not relevant, so the last item takes the place of the removed one.*/
+  s_xTheSystem.m_nLateTasks--;
+  s_xTheSystem.m_pxLateTask[nIdx] = s_xTheSystem.m_pxLateTask[s_xTheSystem.m_nLateTasks];
+  s_xTheSystem.m_eLateTaskPowerMode[nIdx] = s_xTheSystem.m_eLateTaskPowerMode[s_xTheSystem.m_nLateTasks];
+}
+
+static boolean_t InitTaskCompleteLateTasks(void) {
+  boolean_t bRes = FALSE;
+  AManagedTask *pxTask;
+  EPowerMode eActivePowerMode = IapmhGetActivePowerMode(s_xTheSystem.m_pxAppPowerModeHelper);
+  uint8_t nIdx = 0;
+
+  while (nIdx < s_xTheSystem.m_nLateTasks) {
+    pxTask = s_xTheSystem.m_pxLateTask[nIdx];
+    if ((pxTask->m_xStatus.nDelayPowerModeSwitch == 0U) && ((s_xTheSystem.m_eLateTaskPowerMode[nIdx] == eActivePowerMode)
+        || IapmhIsPowerModeTransactionValid(s_xTheSystem.m_pxAppPowerModeHelper, s_xTheSystem.m_eLateTaskPowerMode[nIdx], eActivePowerMode))) {
+      /* the task is waiting in AMTWaitPowerModeSwitch(). The power modes it missed are skipped.*/
+      SYS_DEBUGF(SYS_DBG_LEVEL_VERBOSE, ("INIT: %s completes the PM switch\r\n", pcTaskGetName(pxTask->m_xTaskHandle)));
+      if (AMTIsPowerModeSwitchRequired(pxTask, s_xTheSystem.m_eLateTaskPowerMode[nIdx], eActivePowerMode)) {
+        AMTDoEnterPowerMode(pxTask, s_xTheSystem.m_eLateTaskPowerMode[nIdx], eActivePowerMode);
+      }
+      InitTaskRemoveLateTask(nIdx);
+      (void)AMTStatusModify(pxTask, AMT_STATUS_PM_SWITCH_PENDING_Msk, AMT_STATUS_IS_STILL_RUNNING_Msk);
+      if (InitTaskHasStepFunction(pxTask)) {
+        AMTResume(pxTask);
+      }
+      bRes = TRUE;
+    }
+    else {
+      nIdx++;
+    }
+  }
+
+  return bRes;
+}
+
+static boolean_t InitTaskHasStepFunction(AManagedTask *pxTask) {
+  boolean_t bRes = FALSE;
+
+  if (pxTask->m_pfPMState2FuncMap != NULL) {
+    bRes = (pxTask->m_pfPMState2FuncMap[(uint8_t)AMTGetTaskPowerMode(pxTask)] != NULL) ? TRUE : FALSE;
+  }
+  else {
+    /* the task is resumed to let its control loop detect the missing map.*/
+    bRes = TRUE;
+  }
+
+  return bRes;
+}
@@ -0,0 +1,350 @@
+/**
+ ******************************************************************************
+ * @file    sysmem.c
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   System memory allocator.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+
+#include "services/sysmem.h"
+#include "services/syslowpower.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+
+#ifdef SYS_MEM_CFG_POOLS
+
+#define SYS_MEM_POOL_COUNT_ENTRY(size, count)         + 1U
+#define SYS_MEM_POOL_STORAGE_ENTRY(size, count)       + ((count) * SYS_MEM_POOL_BLOCK_SIZE(size))
+#define SYS_MEM_POOL_CFG_ENTRY(size, count)           { (uint16_t)SYS_MEM_POOL_BLOCK_SIZE(size), (uint16_t)(count) },
+
+/**
+ * Specifies the number of pools.
+ */
+#define SYS_MEM_POOL_COUNT                            (0U SYS_MEM_CFG_POOLS(SYS_MEM_POOL_COUNT_ENTRY))
+
+/**
+ * Specifies the size in byte of the storage of all the pools.
+ */
+#define SYS_MEM_POOL_STORAGE_SIZE                     (0U SYS_MEM_CFG_POOLS(SYS_MEM_POOL_STORAGE_ENTRY))
+
+/**
+ * Create a type name for _SysMemPoolCfg.
+ */
+typedef struct _SysMemPoolCfg SysMemPoolCfg;
+
+/**
+ * Configuration of a pool.
+ */
+struct _SysMemPoolCfg {
+  /**
+   * Specifies the size in byte of a block.
+   */
+  uint16_t nBlockSize;
+
+  /**
+   * Specifies the number of blocks.
+   */
+  uint16_t nBlockCount;
+};
+
+/**
+ * Specifies the configuration of the pools, in ascending order of block size.
+ */
+static const SysMemPoolCfg s_xPoolCfg[SYS_MEM_POOL_COUNT] = {
+    SYS_MEM_CFG_POOLS(SYS_MEM_POOL_CFG_ENTRY)
+};
+
+/**
+ * Specifies the storage of all the pools. The pools are placed one after the other.
+ */
+static uint64_t s_anPoolStorage[SYS_MEM_POOL_STORAGE_SIZE / sizeof(uint64_t)];
+
+/**
+ * Specifies the pools.
+ */
+static SysMemPool s_xPools[SYS_MEM_POOL_COUNT];
+
+#endif /* SYS_MEM_CFG_POOLS */
+
+#ifdef SYS_MEM_CFG_REGIONS
+
+#define SYS_MEM_REGION_EXTERN_ENTRY(start, end, placement)  extern uint8_t start[]; extern uint8_t end[];
+#define SYS_MEM_REGION_COUNT_ENTRY(start, end, placement)   + 1U
+#define SYS_MEM_REGION_CFG_ENTRY(start, end, placement)     { start, end, placement },
+
+/**
+ * Specifies the number of heap regions.
+ */
+#define SYS_MEM_REGION_COUNT                          (0U SYS_MEM_CFG_REGIONS(SYS_MEM_REGION_COUNT_ENTRY))
+
+/* the regions are delimited by symbols of the linker script.*/
+SYS_MEM_CFG_REGIONS(SYS_MEM_REGION_EXTERN_ENTRY)
+
+/**
+ * Create a type name for _SysMemRegionCfg.
+ */
+typedef struct _SysMemRegionCfg SysMemRegionCfg;
+
+/**
+ * Configuration of a heap region.
+ */
+struct _SysMemRegionCfg {
+  /**
+   * Specifies the first byte of the region.
+   */
+  uint8_t *pnStart;
+
+  /**
+   * Specifies the first byte after the region.
+   */
+  uint8_t *pnEnd;
+
+  /**
+   * Specifies the placement of the region.
+   */
+  ESysMemPlacement ePlacement;
+};
+
+/**
+ * Specifies the configuration of the heap regions.
+ */
+static const SysMemRegionCfg s_xRegionCfg[SYS_MEM_REGION_COUNT] = {
+    SYS_MEM_CFG_REGIONS(SYS_MEM_REGION_CFG_ENTRY)
+};
+
+/**
+ * Specifies the heaps of the regions.
+ */
+static SysMemHeap s_xRegions[SYS_MEM_REGION_COUNT];
+
+/**
+ * Specifies if a region has been initialized. A region can be empty if the linker used all the memory of the bank.
+ */
+static boolean_t s_bRegionReady[SYS_MEM_REGION_COUNT];
+
+#endif /* SYS_MEM_CFG_REGIONS */
+
+/**
+ * Specifies the number of blocks allocated in the FreeRTOS heap.
+ */
+static uint32_t s_nHeapFallbackCount = 0;
+
+
+/* Private member function declaration */
+/***************************************/
+
+/**
+ * Allocate a memory block in the first heap region that can serve the request.
+ *
+ * @param nSize [IN] specifies the size in byte of the block.
+ * @param ePlacement [IN] specifies the placement of the regions to use. ::E_SYS_MEM_ANY means all the regions.
+ * @return a pointer to the block, or NULL if no region can serve the request.
+ */
+static void *SysMemAllocFromRegions(size_t nSize, ESysMemPlacement ePlacement);
+
+
+/* Public API definition */
+/*************************/
+
+void SysMemInit(void) {
+#ifdef SYS_MEM_CFG_POOLS
+  uint8_t *pnStorage = (uint8_t*)s_anPoolStorage;
+
+  for (uint8_t i = 0; i < SYS_MEM_POOL_COUNT; ++i) {
+    assert_param((i == 0U) || (s_xPoolCfg[i].nBlockSize > s_xPoolCfg[i - 1U].nBlockSize));
+    (void)SysMemPoolInit(&s_xPools[i], pnStorage, s_xPoolCfg[i].nBlockSize, s_xPoolCfg[i].nBlockCount);
+    pnStorage += (uint32_t)s_xPoolCfg[i].nBlockSize * s_xPoolCfg[i].nBlockCount;
+  }
+#endif
+
+#ifdef SYS_MEM_CFG_REGIONS
+  for (uint8_t i = 0; i < SYS_MEM_REGION_COUNT; ++i) {
+    s_bRegionReady[i] = (SysMemHeapInit(&s_xRegions[i], s_xRegionCfg[i].pnStart, s_xRegionCfg[i].pnEnd) == SYS_NO_ERROR_CODE) ? TRUE : FALSE;
+  }
+#endif
+}
+
+__weak void *SysAlloc(size_t nSize) {
+  void *pvData = NULL;
+
+#ifdef SYS_MEM_CFG_POOLS
+  /* the number of size classes is a constant, so the allocation time does not depend on the memory usage.*/
+  for (uint8_t i = 0; (i < SYS_MEM_POOL_COUNT) && (pvData == NULL); ++i) {
+    if (nSize <= s_xPoolCfg[i].nBlockSize) {
+      pvData = SysMemPoolAlloc(&s_xPools[i]);
+    }
+  }
+#endif
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+  if ((pvData == NULL) && !SYS_IS_CALLED_FROM_ISR()) {
+    pvData = pvPortMalloc(nSize);
+    if (pvData != NULL) {
+      taskENTER_CRITICAL();
+      s_nHeapFallbackCount++;
+      taskEXIT_CRITICAL();
+    }
+  }
+#endif
+
+  if ((pvData == NULL) && !SYS_IS_CALLED_FROM_ISR()) {
+    pvData = SysMemAllocFromRegions(nSize, E_SYS_MEM_ANY);
+  }
+
+  if (pvData == NULL) {
+    SYS_SET_SERVICE_LEVEL_ERROR_CODE(SYS_OUT_OF_MEMORY_ERROR_CODE);
+  }
+
+  return pvData;
+}
+
+__weak void *SysAllocEx(size_t nSize, ESysMemPlacement ePlacement) {
+  void *pvData = NULL;
+
+  if ((ePlacement != E_SYS_MEM_ANY) && !SYS_IS_CALLED_FROM_ISR()) {
+    pvData = SysMemAllocFromRegions(nSize, ePlacement);
+  }
+
+  if (pvData == NULL) {
+    pvData = SysAlloc(nSize);
+  }
+
+  return pvData;
+}
+
+__weak void SysFree(void *pvData) {
+  boolean_t bIsReleased = FALSE;
+  boolean_t bIsFromISR = SYS_IS_CALLED_FROM_ISR();
+
+#ifdef SYS_MEM_CFG_POOLS
+  for (uint8_t i = 0; (i < SYS_MEM_POOL_COUNT) && !bIsReleased; ++i) {
+    if (SysMemPoolContains(&s_xPools[i], pvData)) {
+      (void)SysMemPoolFree(&s_xPools[i], pvData);
+      bIsReleased = TRUE;
+    }
+  }
+#endif
+
+#ifdef SYS_MEM_CFG_REGIONS
+  for (uint8_t i = 0; (i < SYS_MEM_REGION_COUNT) && !bIsReleased; ++i) {
+    if (s_bRegionReady[i] && SysMemHeapContains(&s_xRegions[i], pvData)) {
+      /* the heap of a region suspends the scheduler, so it can be used only by a task (see SysMemHeap.h).*/
+      assert_param(!bIsFromISR);
+      if (!bIsFromISR) {
+        (void)SysMemHeapFree(&s_xRegions[i], pvData);
+      }
+      else {
+        SYS_SET_SERVICE_LEVEL_ERROR_CODE(SYS_INVALID_FUNC_CALL_ERROR_CODE);
+      }
+      bIsReleased = TRUE;
+    }
+  }
+#endif
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+  if (!bIsReleased && (pvData != NULL)) {
+    /* as SysAlloc(), the FreeRTOS heap is used only by a task.*/
+    assert_param(!bIsFromISR);
+    if (!bIsFromISR) {
+      vPortFree(pvData);
+    }
+    else {
+      SYS_SET_SERVICE_LEVEL_ERROR_CODE(SYS_INVALID_FUNC_CALL_ERROR_CODE);
+    }
+  }
+#else
+  UNUSED(bIsReleased);
+  UNUSED(bIsFromISR);
+#endif
+}
+
+uint8_t SysMemGetPoolCount(void) {
+#ifdef SYS_MEM_CFG_POOLS
+  return SYS_MEM_POOL_COUNT;
+#else
+  return 0;
+#endif
+}
+
+sys_error_code_t SysMemGetPoolStats(uint8_t nPool, SysMemPoolStats *pxStats) {
+  assert_param(pxStats != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+
+#ifdef SYS_MEM_CFG_POOLS
+  if (nPool < SYS_MEM_POOL_COUNT) {
+    *pxStats = SysMemPoolGetStats(&s_xPools[nPool]);
+  }
+  else
+#endif
+  {
+    UNUSED(nPool);
+    xRes = SYS_INVALID_PARAMETER_ERROR_CODE;
+  }
+
+  return xRes;
+}
+
+uint32_t SysMemGetHeapFallbackCount(void) {
+  return s_nHeapFallbackCount;
+}
+
+uint8_t SysMemGetRegionCount(void) {
+#ifdef SYS_MEM_CFG_REGIONS
+  return SYS_MEM_REGION_COUNT;
+#else
+  return 0;
+#endif
+}
+
+sys_error_code_t SysMemGetRegionStats(uint8_t nRegion, SysMemHeapStats *pxStats) {
+  assert_param(pxStats != NULL);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+
+#ifdef SYS_MEM_CFG_REGIONS
+  if ((nRegion < SYS_MEM_REGION_COUNT) && s_bRegionReady[nRegion]) {
+    *pxStats = SysMemHeapGetStats(&s_xRegions[nRegion]);
+  }
+  else
+#endif
+  {
+    UNUSED(nRegion);
+    xRes = SYS_INVALID_PARAMETER_ERROR_CODE;
+  }
+
+  return xRes;
+}
+
+
+/* Private function definition */
+/*******************************/
+
+static void *SysMemAllocFromRegions(size_t nSize, ESysMemPlacement ePlacement) {
+  void *pvData = NULL;
+
+#ifdef SYS_MEM_CFG_REGIONS
+  for (uint8_t i = 0; (i < SYS_MEM_REGION_COUNT) && (pvData == NULL); ++i) {
+    if (s_bRegionReady[i] && ((ePlacement == E_SYS_MEM_ANY) || (ePlacement == s_xRegionCfg[i].ePlacement))) {
+      pvData = SysMemHeapAlloc(&s_xRegions[i], nSize);
+    }
+  }
+#else
+  UNUSED(nSize);
+  UNUSED(ePlacement);
+#endif
+
+  return pvData;
+}
@@ -0,0 +1,158 @@
+/**
+ ******************************************************************************
+ * @file    test_StackGuardHost.c
+ * @author  STMicroelectronics - ST-Korea - MCD Team
+ * @version 3.0.0
+ * @date    Oct 17, 2026
+ *
+ * @brief   Host test of the stack guard.
+ *
+ * It checks the placement of the guard and the attribution of the faults (StackGuardLayout.h) with the host build
+ * of the guard (StackGuardHost.h). A fault that is not a stack overflow must kill the process, so it is tested
+ * in a child process.
+ *
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2021 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file in
+ * the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ ******************************************************************************
+ */
+
+#include "services/StackGuardHost.h"
+#include <setjmp.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+
+#define CHECK(cond) \
+  do { \
+    if (!(cond)) { \
+      (void)fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+      s_nFailures++; \
+    } \
+  } while (0)
+
+/**
+ * Specifies the size of the stack of a fake task, in guard size units.
+ */
+#define TEST_STACK_PAGES                      4U
+
+
+typedef struct _FakeTask {
+  volatile uint8_t *pnStack;
+} FakeTask;
+
+
+static int s_nFailures = 0;
+static sigjmp_buf s_xEnv;
+static const void *volatile s_pvOverflowTask = NULL;
+static volatile uintptr_t s_nOverflowAddress = 0;
+
+
+/* Private function definition */
+/*******************************/
+
+static void OnOverflow(const void *pvTask, uintptr_t nFaultAddress) {
+  s_pvOverflowTask = pvTask;
+  s_nOverflowAddress = nFaultAddress;
+  siglongjmp(s_xEnv, 1);
+}
+
+static void TestLayout(void) {
+  /* the guard is the lowest block of the stack aligned to the guard size.*/
+  CHECK(STKGLayoutGetGuardBase(0x20001000U, 32U) == 0x20001000U);
+  CHECK(STKGLayoutGetGuardBase(0x20001001U, 32U) == 0x20001020U);
+  CHECK(STKGLayoutGetGuardBase(0x2000101FU, 32U) == 0x20001020U);
+
+  CHECK(!STKGLayoutIsInGuard(0x20001000U, 32U, 0x20000FFFU));
+  CHECK(STKGLayoutIsInGuard(0x20001000U, 32U, 0x20001000U));
+  CHECK(STKGLayoutIsInGuard(0x20001000U, 32U, 0x2000101FU));
+  CHECK(!STKGLayoutIsInGuard(0x20001000U, 32U, 0x20001020U));
+  CHECK(!STKGLayoutIsInGuard(0x20001000U, 32U, 0U));
+}
+
+static uint8_t *AllocStack(uintptr_t nGuardSize) {
+  void *pvStack = mmap(NULL, TEST_STACK_PAGES * nGuardSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+  return (pvStack == MAP_FAILED) ? NULL : (uint8_t*)pvStack;
+}
+
+static void TestOverflowIsAttributed(FakeTask *pxTask1, FakeTask *pxTask2, uintptr_t nGuardSize) {
+  /* a write above the guard is fine.*/
+  CHECK(STKGHostOnTaskSwitchedIn(pxTask1, (void*)pxTask1->pnStack) == 0);
+  pxTask1->pnStack[nGuardSize] = 0xA5U;
+
+  /* a write in the guard is a stack overflow of the running task.*/
+  s_pvOverflowTask = NULL;
+  if (sigsetjmp(s_xEnv, 1) == 0) {
+    pxTask1->pnStack[nGuardSize - 1U] = 0xA5U;
+    CHECK(0);
+  }
+  CHECK(s_pvOverflowTask == pxTask1);
+  CHECK(s_nOverflowAddress == (uintptr_t)&pxTask1->pnStack[nGuardSize - 1U]);
+
+  /* the guard follows the running task, and the stack of the previous task is released.*/
+  CHECK(STKGHostOnTaskSwitchedIn(pxTask1, (void*)pxTask1->pnStack) == 0);
+  CHECK(STKGHostOnTaskSwitchedIn(pxTask2, (void*)pxTask2->pnStack) == 0);
+  pxTask1->pnStack[0] = 0xA5U;
+  s_pvOverflowTask = NULL;
+  if (sigsetjmp(s_xEnv, 1) == 0) {
+    pxTask2->pnStack[0] = 0xA5U;
+    CHECK(0);
+  }
+  CHECK(s_pvOverflowTask == pxTask2);
+  CHECK(s_nOverflowAddress == (uintptr_t)pxTask2->pnStack);
+}
+
+static void TestOtherFaultIsNotAttributed(FakeTask *pxTask1, uintptr_t nGuardSize) {
+  int nStatus = 0;
+  pid_t nPid = fork();
+
+  if (nPid == 0) {
+    /* a fault outside the guard is not a stack overflow: the hook is not called and the default action kills the child.*/
+    volatile uint8_t *pnReadOnly = AllocStack(nGuardSize);
+    if ((pnReadOnly == NULL) || (mprotect((void*)pnReadOnly, nGuardSize, PROT_READ) != 0)) {
+      _exit(2);
+    }
+    (void)STKGHostOnTaskSwitchedIn(pxTask1, (void*)pxTask1->pnStack);
+    if (sigsetjmp(s_xEnv, 1) == 0) {
+      pnReadOnly[0] = 0xA5U;
+    }
+    _exit(1);
+  }
+  CHECK(nPid > 0);
+  CHECK(waitpid(nPid, &nStatus, 0) == nPid);
+  CHECK(WIFSIGNALED(nStatus) && (WTERMSIG(nStatus) == SIGSEGV));
+}
+
+
+/* Public API definition */
+/*************************/
+
+int main(void) {
+  uintptr_t nGuardSize = STKGHostGetGuardSize();
+  FakeTask xTask1 = { AllocStack(nGuardSize) };
+  FakeTask xTask2 = { AllocStack(nGuardSize) };
+
+  if ((xTask1.pnStack == NULL) || (xTask2.pnStack == NULL) || (STKGHostInit(OnOverflow) != 0)) {
+    (void)fprintf(stderr, "test setup failed\n");
+    return EXIT_FAILURE;
+  }
+
+  TestLayout();
+  TestOverflowIsAttributed(&xTask1, &xTask2, nGuardSize);
+  TestOtherFaultIsNotAttributed(&xTask1, nGuardSize);
+
+  (void)printf("%s: %d failure(s)\n", __FILE__, s_nFailures);
+
+  return (s_nFailures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -29,11 +29,13 @@ extern "C" {
 
 sys_error_code_t AppPowerModeHelper_vtblInit(IAppPowerModeHelper *this); ///< @sa IapmhInit
 EPowerMode AppPowerModeHelper_vtblComputeNewPowerMode(IAppPowerModeHelper *this, const SysEvent xEvent); ///< @sa IapmhComputeNewPowerMode
+EPowerMode AppPowerModeHelper_vtblComputeNewPowerModeFrom(IAppPowerModeHelper *this, const EPowerMode eFromPowerMode, const SysEvent xEvent); ///< @sa IapmhComputeNewPowerModeFrom
 boolean_t AppPowerModeHelper_vtblCheckPowerModeTransaction(IAppPowerModeHelper *this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode); ///< @sa IapmhCheckPowerModeTransaction
 sys_error_code_t AppPowerModeHelper_vtblDidEnterPowerMode(IAppPowerModeHelper *this, EPowerMode ePowerMode); ///< @sa IapmhDidEnterPowerMode
 EPowerMode AppPowerModeHelper_vtblGetActivePowerMode(IAppPowerModeHelper *this); ///< @sa IapmhGetActivePowerMode
 SysPowerStatus AppPowerModeHelper_vtblGetPowerStatus(IAppPowerModeHelper *this); ///< @sa IapmhGetPowerStatus
 boolean_t AppPowerModeHelper_vtblIsLowPowerMode(IAppPowerModeHelper *this, const EPowerMode ePowerMode); ///< @sa IapmhIsLowPowerMode
+boolean_t AppPowerModeHelper_vtblIsPowerModeTransactionValid(IAppPowerModeHelper *this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode); ///< @sa IapmhIsPowerModeTransactionValid
 
 
 #ifdef __cplusplus
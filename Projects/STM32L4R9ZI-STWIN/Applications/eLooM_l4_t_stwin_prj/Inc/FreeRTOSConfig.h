@@ -56,7 +56,7 @@
 #define configMINIMAL_STACK_SIZE                 ((uint16_t)70)
 #define configUSE_16_BIT_TICKS                   0
 #define configIDLE_SHOULD_YIELD                  1
-#define configUSE_TASK_NOTIFICATIONS             0
+#define configUSE_TASK_NOTIFICATIONS             1
 #if defined(DEBUG) || defined(SYS_DEBUG)
 #define configUSE_MUTEXES                        1
 #else
@@ -78,8 +78,10 @@
 #define configUSE_NEWLIB_REENTRANT               0
 #endif
 
-/* Memory allocation related definitions. */
-#define configSUPPORT_STATIC_ALLOCATION          0
+/* Memory allocation related definitions.
+ * Define configSUPPORT_DYNAMIC_ALLOCATION to 0 to build eLooM in static allocation mode: all the system objects
+ * are allocated by the linker and the FreeRTOS heap (heap_4.c) must be excluded from the build. */
+#define configSUPPORT_STATIC_ALLOCATION          1
 #define configSUPPORT_DYNAMIC_ALLOCATION         1
 #if defined(DEBUG) || (SYS_DBG_ENABLE_TA4>=1)
 #define configTOTAL_HEAP_SIZE                    ((size_t)(6*1024))
@@ -91,7 +93,7 @@
 /* Hook function related definitions. */
 #define configUSE_IDLE_HOOK                      1
 #define configUSE_TICK_HOOK                      0
-#ifdef DEBUG
+#if defined(DEBUG) && (SYS_CFG_ENABLE_MPU_STACK_GUARD != 1)
 #define configCHECK_FOR_STACK_OVERFLOW           2
 #else
 #define configCHECK_FOR_STACK_OVERFLOW           0
@@ -133,14 +135,14 @@
 to exclude the API function. */
 #define INCLUDE_vTaskPrioritySet                 0
 #define INCLUDE_uxTaskPriorityGet                0
-#define INCLUDE_vTaskDelete                      0
+#define INCLUDE_vTaskDelete                      1
 #define INCLUDE_vTaskSuspend                     1
-#define INCLUDE_vTaskDelayUntil                  0
+#define INCLUDE_vTaskDelayUntil                  1
 #define INCLUDE_vTaskDelay                       1
 #define INCLUDE_vTaskCleanUpResources            0
 #define INCLUDE_xTaskGetSchedulerState           1
 #define INCLUDE_xTaskGetCurrentTaskHandle        1
-#define INCLUDE_uxTaskGetStackHighWaterMark      0
+#define INCLUDE_uxTaskGetStackHighWaterMark      1
 #define INCLUDE_xTaskGetIdleTaskHandle           0
 #define INCLUDE_eTaskGetState                    0
 #define INCLUDE_xEventGroupSetBitFromISR         0
@@ -220,6 +222,30 @@ extern uint32_t g_ulHighFrequencyTimerTicks;
 #define portGET_RUN_TIME_COUNTER_VALUE() g_ulHighFrequencyTimerTicks
 #endif
 
+// Step profiler (see AMTStepProfiler.h). The CPU time of a step does not count the time the task is switched out.
+#if (AMT_CFG_ENABLE_STEP_PROFILER == 1)
+#if (SYS_DBG_ENABLE_TA4>=1)
+#error The step profiler uses traceTASK_SWITCHED_IN() and traceTASK_SWITCHED_OUT() that are defined also by the Tracealyzer recorder.
+#endif
+extern void AMTSPOnTaskSwitchedIn(const void *pvTCB);
+extern void AMTSPOnTaskSwitchedOut(void);
+#define AMTSP_TASK_SWITCHED_IN() AMTSPOnTaskSwitchedIn(pxCurrentTCB)
+#define traceTASK_SWITCHED_OUT() AMTSPOnTaskSwitchedOut()
+#else
+#define AMTSP_TASK_SWITCHED_IN()
+#endif
+
+// MPU stack guard (see StackGuard.h). It replaces configCHECK_FOR_STACK_OVERFLOW.
+#if (SYS_CFG_ENABLE_MPU_STACK_GUARD == 1)
+#if (SYS_DBG_ENABLE_TA4>=1)
+#error The MPU stack guard uses traceTASK_SWITCHED_IN() that is defined also by the Tracealyzer recorder.
+#endif
+extern void STKGOnTaskSwitchedIn(const void *pvStackBottom);
+#define traceTASK_SWITCHED_IN() STKGOnTaskSwitchedIn(pxCurrentTCB->pxStack); AMTSP_TASK_SWITCHED_IN()
+#elif (AMT_CFG_ENABLE_STEP_PROFILER == 1)
+#define traceTASK_SWITCHED_IN() AMTSP_TASK_SWITCHED_IN()
+#endif
+
 // Tracealyzer recorder library
 #if (SYS_DBG_ENABLE_TA4>=1)
 #include "trcRecorder.h"
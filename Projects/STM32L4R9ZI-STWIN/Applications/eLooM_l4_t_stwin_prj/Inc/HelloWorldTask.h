@@ -32,8 +32,8 @@ extern "C" {
 
 #include "services/systp.h"
 #include "services/syserror.h"
-#include "services/AManagedTask.h"
-#include "services/AManagedTask_vtbl.h"
+#include "services/APeriodicManagedTask.h"
+#include "services/APeriodicManagedTask_vtbl.h"
 #include "drivers/IDriver.h"
 #include "drivers/IDriver_vtbl.h"
 
@@ -49,7 +49,7 @@ struct _HelloWorldTask {
   /**
    * Base class object.
    */
-  AManagedTask super;
+  APeriodicManagedTask super;
 
   // Task variables should be added here.
 
@@ -35,6 +35,9 @@ sys_error_code_t HelloWorldTask_vtblDoEnterPowerMode(AManagedTask *this, const E
 sys_error_code_t HelloWorldTask_vtblHandleError(AManagedTask *this, SysEvent xError); ///< @sa AMTHandleError
 sys_error_code_t HelloWorldTask_vtblOnEnterTaskControlLoop(AManagedTask *this); ///< @sa AMTOnEnterTaskControlLoop
 
+// AManagedTaskEx virtual functions
+sys_error_code_t HelloWorldTask_vtblOnEnterPowerMode(AManagedTaskEx *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode); ///< @sa AMTExOnEnterPowerMode
+
 #ifdef __cplusplus
 }
 #endif
@@ -26,6 +26,7 @@
 #include "drivers/PushButtonDrv.h"
 #include "drivers/PushButtonDrv_vtbl.h"
 #include "services/sysdebug.h"
+#include "services/DeferredWorkQueue.h"
 
 #ifndef HW_TASK_CFG_STACK_DEPTH
 #define HW_TASK_CFG_STACK_DEPTH                  120
@@ -35,6 +36,10 @@
 #define HW_TASK_CFG_PRIORITY                     (tskIDLE_PRIORITY+1)
 #endif
 
+#ifndef HW_TASK_CFG_PERIOD_MS
+#define HW_TASK_CFG_PERIOD_MS                    1000U
+#endif
+
 #define HW_TASK_ANTI_DEBOUNCH_PERIOD_TICK        7U
 
 #define SYS_DEBUGF(level, message)               SYS_DEBUGF3(SYS_DBG_HW, level, message)
@@ -55,6 +60,15 @@ static HelloWorldTask s_xTaskObj;
  */
 static sys_error_code_t HelloWorldTaskExecuteStepState1(AManagedTask *_this);
 
+/**
+ * Deferred part of the push button interrupt. It is executed by the deferred work queue task.
+ *
+ * @param pvArg [IN] not used.
+ * @param nParam [IN] specifies the tick count when the button has been pressed.
+ * @return SYS_NO_EROR_CODE
+ */
+static sys_error_code_t HelloWorldTaskOnButtonPressed(void *pvArg, uint32_t nParam);
+
 /**
  * Class object declaration
  */
@@ -63,7 +77,7 @@ typedef struct _HelloWorldClass
   /**
    * HelloWorldTask class virtual table.
    */
-  AManagedTask_vtbl m_xVTBL;
+  AManagedTaskEx_vtbl m_xVTBL;
 
   /**
    * HelloWorldTask (PM_STATE, ExecuteStepFunc) map.
@@ -81,7 +95,9 @@ static const HelloWorldClass s_xTheClass = {
     HelloWorldTask_vtblOnCreateTask,
     HelloWorldTask_vtblDoEnterPowerMode,
     HelloWorldTask_vtblHandleError,
-    HelloWorldTask_vtblOnEnterTaskControlLoop
+    HelloWorldTask_vtblOnEnterTaskControlLoop,
+    APMT_vtblForceExecuteStep,
+    HelloWorldTask_vtblOnEnterPowerMode
   },
 
   /* class (PM_STATE, ExecuteStepFunc) map */
@@ -92,6 +108,15 @@ static const HelloWorldClass s_xTheClass = {
   }
 };
 
+/**
+ * HelloWorldTask (PM_STATE, period in ms) map.
+ */
+static const uint32_t s_pnPMState2PeriodMap[] = {
+  HW_TASK_CFG_PERIOD_MS,
+  0,
+  0
+};
+
 // Inline function forward declaration
 // ***********************************
 
@@ -107,9 +132,9 @@ AManagedTask* HelloWorldTaskAlloc(const void *p_mx_drv_cfg)
   // so this allocator implement the singleton design pattern.
 
   // Initialize the super class
-  AMTInit(&s_xTaskObj.super);
+  APMTInit(&s_xTaskObj.super, s_pnPMState2PeriodMap, E_APMT_OVERRUN_SKIP);
 
-  s_xTaskObj.super.vptr = &s_xTheClass.m_xVTBL;
+  s_xTaskObj.super.super.vptr = &s_xTheClass.m_xVTBL;
 
   s_xTaskObj.p_mx_drv_cfg = p_mx_drv_cfg;
 
@@ -156,7 +181,7 @@ sys_error_code_t HelloWorldTask_vtblOnCreateTask(AManagedTask *_this, TaskFuncti
   _this->m_pfPMState2FuncMap = s_xTheClass.m_pfPMState2FuncMap;
 
 //  *pvTaskCode = HelloWorldTaskRun;
-  *pvTaskCode = AMTRun;
+  *pvTaskCode = APMTRun;
   *pcName = "HW";
   *pnStackDepth = HW_TASK_CFG_STACK_DEPTH;
   *pParams = _this;
@@ -216,6 +241,18 @@ sys_error_code_t HelloWorldTask_vtblOnEnterTaskControlLoop(AManagedTask *_this)
   return xRes;
 }
 
+// AManagedTaskEx virtual functions definition
+// *******************************************
+
+sys_error_code_t HelloWorldTask_vtblOnEnterPowerMode(AManagedTaskEx *_this, const EPowerMode eActivePowerMode, const EPowerMode eNewPowerMode)
+{
+  assert_param(_this);
+  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
+//  HelloWorldTask *pObj = (HelloWorldTask*)_this;
+
+  return xRes;
+}
+
 // Private function definition
 // ***************************
 
@@ -224,7 +261,6 @@ static sys_error_code_t HelloWorldTaskExecuteStepState1(AManagedTask *_this)
   assert_param(_this != NULL);
   sys_error_code_t xRes = SYS_NO_ERROR_CODE;
 
-  vTaskDelay(pdMS_TO_TICKS(1000));
   SYS_DEBUGF(SYS_DBG_LEVEL_VERBOSE, ("Hello STWINCSV1!!\r\n"));
   __NOP();
   __NOP();
@@ -232,26 +268,38 @@ static sys_error_code_t HelloWorldTaskExecuteStepState1(AManagedTask *_this)
   return xRes;
 }
 
+static sys_error_code_t HelloWorldTaskOnButtonPressed(void *pvArg, uint32_t nParam)
+{
+  UNUSED(pvArg);
+  /* anti debounch */
+  static uint32_t t_start = 0;
+  if(nParam - t_start > 10*HW_TASK_ANTI_DEBOUNCH_PERIOD_TICK)
+  {
+    /* generate the system event to change the PM state*/
+    SysEvent evt = {
+        .nRawEvent = SYS_PM_MAKE_EVENT(SYS_PM_EVT_SRC_PB, SYS_PM_EVT_PARAM_SHORT_PRESS)
+    };
+    SysPostPowerModeEvent(evt);
+
+    t_start = nParam;
+  }
+
+  return SYS_NO_ERROR_CODE;
+}
+
 
 /* CubeMX Integration */
 /**********************/
 
 void HW_PB_EXTI_Callback(uint16_t pin)
 {
-  /* anti debounch */
-  static uint32_t t_start = 0;
-  if(HAL_GetTick() - t_start > 10*HW_TASK_ANTI_DEBOUNCH_PERIOD_TICK)
-  {
-    if(pin == USER_BUTTON_Pin)
-    {
-      /* generate the system event to change the PM state*/
-      SysEvent evt = {
-          .nRawEvent = SYS_PM_MAKE_EVENT(SYS_PM_EVT_SRC_PB, SYS_PM_EVT_PARAM_SHORT_PRESS)
-      };
-      SysPostPowerModeEvent(evt);
+  BaseType_t xHigherPriorityTaskWoken = pdFALSE;
 
-      t_start = HAL_GetTick();
-    }
+  if(pin == USER_BUTTON_Pin)
+  {
+    /* the anti debounch and the PM event are done by the deferred work queue.*/
+    (void)DWQSubmitFromISR(HelloWorldTaskOnButtonPressed, NULL, HAL_GetTick(), &xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
   }
 }
 
@@ -45,6 +45,10 @@ void vApplicationStackOverflowHook( TaskHandle_t pxTask, char *pcTaskName )
   configCHECK_FOR_STACK_OVERFLOW is defined to 1 or 2.  This hook
   function is called if a stack overflow is detected. */
   taskDISABLE_INTERRUPTS();
+#if (SYS_CFG_ENABLE_MPU_STACK_GUARD == 1) && !defined(DEBUG)
+  /* the stack guard has recorded the overflow, and INIT reports it to the AED after the reset.*/
+  NVIC_SystemReset();
+#endif
   for( ;; );
 }
 
@@ -109,5 +113,35 @@ void vApplicationIdleHook( void ) {
 #endif
 }
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ * Provide the memory of the IDLE task. It is required by the kernel when configSUPPORT_STATIC_ALLOCATION is 1.
+ */
+void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize )
+{
+  static StaticTask_t s_xIdleTaskTCB;
+  static StackType_t s_xIdleTaskStack[configMINIMAL_STACK_SIZE];
+
+  *ppxIdleTaskTCBBuffer = &s_xIdleTaskTCB;
+  *ppxIdleTaskStackBuffer = s_xIdleTaskStack;
+  *pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
+#if (configUSE_TIMERS == 1)
+/**
+ * Provide the memory of the timer service task. It is required by the kernel when configSUPPORT_STATIC_ALLOCATION is 1.
+ */
+void vApplicationGetTimerTaskMemory( StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint32_t *pulTimerTaskStackSize )
+{
+  static StaticTask_t s_xTimerTaskTCB;
+  static StackType_t s_xTimerTaskStack[configTIMER_TASK_STACK_DEPTH];
+
+  *ppxTimerTaskTCBBuffer = &s_xTimerTaskTCB;
+  *ppxTimerTaskStackBuffer = s_xTimerTaskStack;
+  *pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+#endif
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
 // Private function definition
 // ***************************
@@ -20,6 +20,7 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "drivers/EXTIPinMap.h"
+#include "services/StackGuard.h"
 
 // External variables
 // *******************
@@ -61,6 +62,20 @@ void ExtiDefISR() {
 /*            Cortex-M4 Processor Interruption and Exception Handlers         */
 /******************************************************************************/
 
+#if (SYS_CFG_ENABLE_MPU_STACK_GUARD == 1)
+/**
+ * @brief This function handles Memory management fault.
+ */
+void MemManage_Handler(void)
+{
+  /* a stack overflow is reported by the stack guard, and the function does not return.*/
+  (void)STKGOnMemManageFault();
+  while (1)
+  {
+  }
+}
+#endif
+
 /**
  * @brief This function handles System tick timer.
  */
@@ -70,7 +70,8 @@ struct _PushButtonDrv_t
 
 /**
  * Allocate an instance of PushButtonDrv_t. The driver is allocated
- * in the FreeRTOS heap.
+ * with SysAlloc(), or it is the only static instance of the driver
+ * in static allocation mode (`configSUPPORT_DYNAMIC_ALLOCATION = 0`).
  *
  * @return a pointer to the generic interface ::IDriver if success,
  * or SYS_OUT_OF_MEMORY_ERROR_CODE otherwise.
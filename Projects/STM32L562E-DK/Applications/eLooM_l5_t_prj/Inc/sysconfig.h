@@ -43,16 +43,23 @@
 #define SYS_CFG_USE_DEFAULT_PM_HELPER             0
 #define SYS_CFG_DEF_PM_HELPER_STANDBY             0  ///< if defined to 1 then the MCU goes in STANDBY mode when the system enters in SLEEP_1.
 
+// file sysmem.c
+#define SYS_MEM_CFG_POOLS(X)                      X(32U, 4U)  ///< size classes X(block size, block count) of SysAlloc() (see sysmem.h).
+
 
 // Tasks configuration
 // *******************
 
 // file IManagedTask.h
 #define MT_ALLOWED_ERROR_COUNT                    0x2
+#define AMT_CFG_ENABLE_STEP_PROFILER              0  ///< if defined to 1 then the task control loops profile the steps (see AMTStepProfiler.h).
 
 // file sysinit.c
 #define INIT_TASK_CFG_ENABLE_BOOT_IF              0
 #define INIT_TASK_CFG_STACK_SIZE                  (configMINIMAL_STACK_SIZE*6)
+#define INIT_TASK_CFG_ENABLE_PM_PROFILER          0  ///< if defined to 1 then INIT profiles the power mode transactions (see PMProfiler.h).
+#define INIT_TASK_CFG_ENABLE_STACK_MONITOR        0  ///< if defined to 1 then INIT monitors the stack usage of the tasks (see StackMonitor.h).
+#define SYS_CFG_ENABLE_MPU_STACK_GUARD            0  ///< if defined to 1 then the MPU guards the stack of the running task (see StackGuard.h).
 
 // file HelloWorldTask.c
 // uncomment the following lines to change the task common parameters
@@ -24,6 +24,8 @@
 
 #include "services/sysdebug.h"
 #include "services/ApplicationContext.h"
+#include "services/sysmanifest.h"
+#include "services/DeferredWorkQueue.h"
 #include "AppPowerModeHelper.h"
 #include "HelloWorldTask.h"
 
@@ -31,30 +33,37 @@
 
 
 
+// Private member function declaration
+// ***********************************
+
 /**
- * HelloWorld task object.
+ * Allocator of the deferred work queue used by the push button interrupt. It adapts DWQAlloc() to the manifest.
+ *
+ * @param pvParams [IN] not used.
+ * @return a pointer to the deferred work queue task object.
  */
-static AManagedTask *spHElloWorldObj = NULL;
+static AManagedTask *AppDWQAlloc(const void *pvParams);
 
 
+/* Application manifest */
+/************************/
 
-/* eLooM framework entry points definition */
-/*******************************************/
+SYS_APP_TASK_MEMORY(DWQ, DWQ_TASK_CFG_STACK_DEPTH);
+SYS_APP_TASK_MEMORY(HW, HW_TASK_CFG_STACK_DEPTH);
 
-sys_error_code_t SysLoadApplicationContext(ApplicationContext *pAppContext)
-{
-  assert_param(pAppContext);
-  sys_error_code_t xRes = SYS_NO_ERROR_CODE;
-
-  // Allocate the task objects
-  spHElloWorldObj = HelloWorldTaskAlloc(&MX_GPIO_PC13InitParams);
+/**
+ * The managed tasks of the application, in the order used by INIT.
+ */
+static const SysAppTaskEntry s_xAppManifest[] = {
+  SYS_APP_STATIC_TASK(DWQ, AppDWQAlloc, NULL),
+  SYS_APP_STATIC_TASK(HW, HelloWorldTaskAlloc, &MX_GPIO_PC13InitParams)
+};
 
 
-  // Add the task object to the context.
-  xRes = ACAddTask(pAppContext, spHElloWorldObj);
+/* eLooM framework entry points definition */
+/*******************************************/
 
-  return xRes;
-}
+SYS_APP_MANIFEST(s_xAppManifest)
 
 sys_error_code_t SysOnStartApplication(ApplicationContext *pAppContext) {
   UNUSED(pAppContext);
@@ -89,3 +98,9 @@ IAppPowerModeHelper *SysGetPowerModeHelper(void)
 /* Private function definition */
 /*******************************/
 
+static AManagedTask *AppDWQAlloc(const void *pvParams) {
+  UNUSED(pvParams);
+
+  return (AManagedTask*)DWQAlloc();
+}
+
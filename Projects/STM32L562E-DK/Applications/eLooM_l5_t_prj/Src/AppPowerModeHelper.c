@@ -26,6 +26,7 @@
 #include "FreeRTOS.h"
 #include "services/sysinit.h"
 #include "services/sysdebug.h"
+#include "services/PMTransitionTable.h"
 
 
 #define SYS_DEBUGF(level, message)      SYS_DEBUGF3(SYS_DBG_APMH, level, message)
@@ -41,9 +42,29 @@ static const IAppPowerModeHelper_vtbl s_xAppPowerModeHelper_vtbl = {
     AppPowerModeHelper_vtblDidEnterPowerMode,
     AppPowerModeHelper_vtblGetActivePowerMode,
     AppPowerModeHelper_vtblGetPowerStatus,
-    AppPowerModeHelper_vtblIsLowPowerMode
+    AppPowerModeHelper_vtblIsLowPowerMode,
+    AppPowerModeHelper_vtblComputeNewPowerModeFrom,
+    AppPowerModeHelper_vtblIsPowerModeTransactionValid
 };
 
+/**
+ * Transitions of the application power mode state machine: X(from, event source, event parameter, to).
+ * An event without a transition does not change the power mode, while an event of a source out of the table is an error.
+ * The long press of the push button in STATE1 does nothing to show the system behavior, and the simple Hello World
+ * demo does not have an application controller object, so SYS_PM_EVT_SRC_CTRL has no transitions.
+ */
+#define APP_PM_TRANSITIONS(X) \
+  X(E_POWER_MODE_STATE1,  SYS_PM_EVT_SRC_PB,       SYS_PM_EVT_PARAM_SHORT_PRESS,  E_POWER_MODE_TEST) \
+  X(E_POWER_MODE_STATE1,  SYS_PM_EVT_SRC_PB,       SYS_PM_EVT_PARAM_DOUBLE_PRESS, E_POWER_MODE_TEST) \
+  X(E_POWER_MODE_STATE1,  SYS_PM_EVT_SRC_LP_TIMER, PMTT_ANY_PARAM,                E_POWER_MODE_SLEEP_1) \
+  X(E_POWER_MODE_TEST,    SYS_PM_EVT_SRC_PB,       PMTT_ANY_PARAM,                E_POWER_MODE_STATE1) \
+  X(E_POWER_MODE_SLEEP_1, SYS_PM_EVT_SRC_PB,       PMTT_ANY_PARAM,                E_POWER_MODE_STATE1)
+
+/**
+ * Application power mode state machine.
+ */
+PMTT_DEFINE(s_app_pm_table, E_POWER_MODE_NONE, 4U, 4U, APP_PM_TRANSITIONS);
+
 /**
  * Internal state of the Application Power Mode Helper.
  */
@@ -67,6 +88,13 @@ struct _AppPowerModeHelper
   EPowerMode previous_run_state;
 };
 
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+/**
+ * In static allocation mode the only instance of the class is allocated by the linker.
+ */
+static AppPowerModeHelper s_the_obj;
+#endif
+
 /* Private member function declaration */
 /***************************************/
 
@@ -79,7 +107,11 @@ extern void SystemClock_Restore(void);
 
 IAppPowerModeHelper *AppPowerModeHelperAlloc(void)
 {
-  IAppPowerModeHelper *p_new_obj = (IAppPowerModeHelper*)pvPortMalloc(sizeof(AppPowerModeHelper));
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+  IAppPowerModeHelper *p_new_obj = (IAppPowerModeHelper*)SysAlloc(sizeof(AppPowerModeHelper));
+#else
+  IAppPowerModeHelper *p_new_obj = (IAppPowerModeHelper*)&s_the_obj;
+#endif
 
   if (p_new_obj == NULL)
   {
@@ -114,59 +146,30 @@ EPowerMode AppPowerModeHelper_vtblComputeNewPowerMode(IAppPowerModeHelper *_this
   assert_param(_this != NULL);
   AppPowerModeHelper *p_obj = (AppPowerModeHelper*)_this;
 
-  EPowerMode power_mode = p_obj->status.active_power_mode;
+  return AppPowerModeHelper_vtblComputeNewPowerModeFrom(_this, p_obj->status.active_power_mode, event);
+}
 
-  switch (event.xEvent.nSource)
-  {
-  case SYS_PM_EVT_SRC_PB:
-    if (power_mode == E_POWER_MODE_STATE1)
-    {
-      /* new state depends on on the event parameter */
-      if (event.xEvent.nParam == SYS_PM_EVT_PARAM_SHORT_PRESS)
-      {
-        power_mode = E_POWER_MODE_TEST;
-      }
-      else if (event.xEvent.nParam == SYS_PM_EVT_PARAM_DOUBLE_PRESS)
-      {
-        power_mode = E_POWER_MODE_TEST;
-      }
-      else if (event.xEvent.nParam == SYS_PM_EVT_PARAM_LONG_PRESS)
-      {
-    	/* do nothing to show the system behavior. */
-        __NOP();
-      }
-    }
-    else if (power_mode == E_POWER_MODE_TEST)
-    {
-      power_mode = E_POWER_MODE_STATE1;
-    }
-    else if (power_mode == E_POWER_MODE_SLEEP_1)
-    {
-      power_mode = E_POWER_MODE_STATE1;
-    }
-    break;
+EPowerMode AppPowerModeHelper_vtblComputeNewPowerModeFrom(IAppPowerModeHelper *_this, const EPowerMode from_power_mode, const SysEvent event)
+{
+  assert_param(_this != NULL);
+  UNUSED(_this);
 
-  case SYS_PM_EVT_SRC_CTRL:
-    /* the simple Hello World demo does not have an application comtroller object. */
-    break;
+  EPowerMode power_mode = from_power_mode;
 
-  case SYS_PM_EVT_SRC_LP_TIMER:
-    if (power_mode == E_POWER_MODE_STATE1)
-    {
-      power_mode = E_POWER_MODE_SLEEP_1;
-    }
-    break;
-
-  default:
+  if (PMTTHasEventSource(&s_app_pm_table, event))
+  {
+    power_mode = PMTTComputeNewPowerMode(&s_app_pm_table, from_power_mode, event);
+  }
+  else
+  {
 
     SYS_DEBUGF(SYS_DBG_LEVEL_VERBOSE, ("PMH: wrong SysEvent.\r\n"));
 
     sys_error_handler();
-    break;
   }
 
 #ifdef SYS_DEBUG
-  SYS_DEBUGF(SYS_DBG_LEVEL_VERBOSE, ("PMH: new PM:%u-%u.\r\n", p_obj->status.active_power_mode, power_mode));
+  SYS_DEBUGF(SYS_DBG_LEVEL_VERBOSE, ("PMH: new PM:%u-%u.\r\n", from_power_mode, power_mode));
 #endif
 
   return power_mode;
@@ -174,27 +177,7 @@ EPowerMode AppPowerModeHelper_vtblComputeNewPowerMode(IAppPowerModeHelper *_this
 
 boolean_t AppPowerModeHelper_vtblCheckPowerModeTransaction(IAppPowerModeHelper *_this, const EPowerMode active_power_mode, const EPowerMode new_power_mode) {
   UNUSED(_this);
-  boolean_t res = FALSE;
-
-  switch (active_power_mode) {
-  case E_POWER_MODE_STATE1:
-    if ((new_power_mode == E_POWER_MODE_TEST) || (new_power_mode == E_POWER_MODE_SLEEP_1)) {
-      res = TRUE;
-    }
-    break;
-  case E_POWER_MODE_TEST:
-    if (new_power_mode == E_POWER_MODE_STATE1) {
-      res = TRUE;
-    }
-    break;
-    break;  case E_POWER_MODE_SLEEP_1:
-    if (new_power_mode == E_POWER_MODE_STATE1) {
-      res = TRUE;
-    }
-    break;
-  default:
-    res = FALSE;
-  }
+  boolean_t res = PMTTIsTransactionValid(&s_app_pm_table, active_power_mode, new_power_mode);
 
   if (res == FALSE) {
 
@@ -208,6 +191,12 @@ boolean_t AppPowerModeHelper_vtblCheckPowerModeTransaction(IAppPowerModeHelper *
   return res;
 }
 
+boolean_t AppPowerModeHelper_vtblIsPowerModeTransactionValid(IAppPowerModeHelper *_this, const EPowerMode active_power_mode, const EPowerMode new_power_mode) {
+  UNUSED(_this);
+
+  return PMTTIsTransactionValid(&s_app_pm_table, active_power_mode, new_power_mode);
+}
+
 sys_error_code_t AppPowerModeHelper_vtblDidEnterPowerMode(IAppPowerModeHelper *_this, EPowerMode power_mode) {
   assert_param(_this != NULL);
   sys_error_code_t res = SYS_NO_ERROR_CODE;
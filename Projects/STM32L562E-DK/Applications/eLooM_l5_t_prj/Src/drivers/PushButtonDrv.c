@@ -10,6 +10,7 @@
 #include "drivers/PushButtonDrv_vtbl.h"
 #include "FreeRTOS.h"
 #include "services/sysdebug.h"
+#include "services/sysmem.h"
 
 #define SYS_DEBUGF(level, message)      SYS_DEBUGF3(SYS_DBG_DRIVERS, level, message)
 
@@ -38,6 +39,13 @@ static PushButtonDrvClass_t sTheClass = {
 	}
 };
 
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+/**
+ * In static allocation mode the only instance of the driver is allocated by the linker.
+ */
+static PushButtonDrv_t s_the_obj;
+#endif
+
 /* Private member function declaration */
 /***************************************/
 
@@ -50,7 +58,11 @@ static PushButtonDrvClass_t sTheClass = {
 
 IDriver *PushButtonDrvAlloc(void)
 {
-  IDriver *p_new_obj = (IDriver*)pvPortMalloc(sizeof(PushButtonDrv_t));
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+  IDriver *p_new_obj = (IDriver*)SysAlloc(sizeof(PushButtonDrv_t));
+#else
+  IDriver *p_new_obj = (IDriver*)&s_the_obj;
+#endif
 
   if (p_new_obj == NULL) {
     SYS_SET_LOW_LEVEL_ERROR_CODE(SYS_OUT_OF_MEMORY_ERROR_CODE);
@@ -24,6 +24,7 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "drivers/EXTIPinMap.h"
+#include "services/StackGuard.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -109,7 +110,10 @@ void HardFault_Handler(void)
 void MemManage_Handler(void)
 {
   /* USER CODE BEGIN MemoryManagement_IRQn 0 */
-
+#if (SYS_CFG_ENABLE_MPU_STACK_GUARD == 1)
+  /* a stack overflow is reported by the stack guard, and the function does not return.*/
+  (void)STKGOnMemManageFault();
+#endif
   /* USER CODE END MemoryManagement_IRQn 0 */
   while (1)
   {